@@ -9,6 +9,9 @@
 #include "uart0.h"
 #include "uart1.h"
 
+#include <string.h>  // For the memcpy() and memcmp()
+#include <avr/pgmspace.h>
+
 #define F_CPU 32000000
 #include "util/delay.h"
 
@@ -23,113 +26,1784 @@ extern void (*app_func_rd_pointer[])(void);
 extern bool (*app_func_wr_pointer[])(void*);
 
 /************************************************************************/
-/* Initialize app                                                       */
+/* Initialize app                                                       */
+/************************************************************************/
+static const uint8_t default_device_name[] = "RgbArray";
+
+void hwbp_app_initialize(void)
+{
+	   /* Define versions */
+    uint8_t hwH = 1;
+    uint8_t hwL = 0;
+    uint8_t fwH = 2;
+    uint8_t fwL = 0;
+    uint8_t ass = 0;
+    
+   	/* Start core */
+    core_func_start_core(
+        1264,
+        hwH, hwL,
+        fwH, fwL,
+        ass,
+        (uint8_t*)(&app_regs),
+        APP_NBYTES_OF_REG_BANK,
+        APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1,
+		default_device_name,
+		false,	// The device is _not_ able to repeat the harp timestamp clock
+		false	// The device is _not_ able to generate the harp timestamp clock
+    );
+}
+
+/************************************************************************/
+/* Handle if a catastrophic error occur                                 */
+/************************************************************************/
+void core_callback_catastrophic_error_detected(void)
+{
+   clr_DEMO_MODE0;
+   clr_DEMO_MODE1;
+   
+   set_DISABLE_LEDS0;
+   set_DISABLE_LEDS1;
+   clr_DISABLE_LEDS0;
+   clr_DISABLE_LEDS1;
+   
+   clr_DO0;
+   clr_DO1;
+   clr_DO2;
+   clr_DO3;
+   clr_DO4;
+}
+
+/************************************************************************/
+/* General definitions                                                  */
+/************************************************************************/
+// #define NBYTES 23
+
+void check_load_timeout (void);   // On interrupts.c
+
+/************************************************************************/
+/* General used functions                                               */
+/************************************************************************/
+uint8_t cmd_array[4] = {'r', 'g', 'b', 0};   // Command and REG_LEDS_ON_BUS/2
+uint8_t cmd_demo[4]  = {'r', 'g', 'c', 0};   // Command and REG_LEDS_ON_BUS/2
+uint8_t cmd_off[4]  = {'r', 'g', 'd', 0};   // Command and REG_LEDS_ON_BUS/2
+uint8_t cmd_strips[4] = {'r', 'g', 'p', 0};  // Command and number of strips
+uint8_t cmd_window[5] = {'r', 'g', 'w', 0, 0};  // Command, first LED and number of LEDs
+uint8_t cmd_scatter[4] = {'r', 'g', 'x', 0};    // Command and number of LEDs
+uint8_t cmd_store[4] = {'r', 'g', 'q', 0};      // Command and REG_LEDS_ON_BUS
+uint8_t cmd_sequence[4] = {'r', 'g', 'k', 0};   // Command and REG_SEQUENCE_CONTROL
+uint8_t cmd_brightness[4] = {'r', 'g', 'i', 0}; // Command and REG_BRIGHTNESS
+uint8_t cmd_gamma[4] = {'r', 'g', 'y', 0};      // Command and REG_GAMMA
+uint8_t cmd_effect[3] = {'r', 'g', 'e'};        // Command, followed by REG_EFFECT
+uint8_t cmd_fade[5] = {'r', 'g', 'f', 0, 0};    // Command and REG_FADE_DURATION
+uint8_t cmd_page[6] = {'r', 'g', 's', 0, 0, 0}; // Command, first LED and number of LEDs
+uint8_t cmd_commit[5] = {'r', 'g', 'l', 0, 0};  // Command and REG_EXTENDED_LEDS
+uint8_t cmd_palette[5] = {'r', 'g', 'a', 0, PALETTE_ENTRIES}; // Command, first entry and number of entries
+uint8_t cmd_indexed[5] = {'r', 'g', 'o', 0, 0}; // Command, bits of the indexes and REG_LEDS_ON_BUS
+uint8_t cmd_store_indexed[5] = {'r', 'g', 'h', 0, 0};  // Command, bits of the indexes and REG_LEDS_ON_BUS
+uint8_t cmd_runs[4] = {'r', 'g', 'n', 0};       // Command and number of runs
+
+/*
+* With the paged frames the buses may have more than 255 LEDs, which doesn't fit
+* on the commands with a length of 8 bits, so they keep the length of the last frame.
+*/
+static uint8_t short_leds_on_bus (void)
+{
+   return app_regs.REG_EXTENDED_LEDS ? 0 : app_regs.REG_LEDS_ON_BUS;
+}
+
+uint8_t sequence_frames[2] = {0, 0};            // Frames stored on each bus
+uint8_t loads_pending = 0;                      // Buses loading a frame, B_BUS0 and B_BUS1
+
+uint8_t shadow_frame[2][96];                    // Last frame sent to each bus
+uint8_t shadow_valid = 0;                       // Buses that have the shadow frame, B_BUS0 and B_BUS1
+uint8_t frame_scratch[102];                     // Parts with the LEDs that changed, or the runs of a frame
+
+/************************************************************************/
+/* Link                                                                 */
+/************************************************************************/
+/*
+* The buses start with the 'r' 'g' commands at 1 Mb/s. Each slave is asked for its
+* version and, if it knows the v2 framing, switched to it at the fastest speed both
+* can use. The new speed is probed and, if the slave doesn't reply, the next one
+* below is tried. The protocol is described on RgbDriver/main.c.
+*
+* Once ready, the errors of the slave are asked every LINK_HEALTH_MS, which also keeps
+* the v2 link alive. After LINK_RESYNC_ERRORS reports with errors in a row, the link
+* goes back to 1 Mb/s, waits for the slave to do the same and is negotiated again.
+*/
+#define LINK_SYNC 0x7E
+#define LINK_REPLY_MS 20         // Wait for the LINK_INFO and the LINK_SWITCH
+#define LINK_PROBE_MS 150        // Longer than the 100 ms the slave waits before going back
+#define LINK_HEALTH_MS 50        // Shorter than the 100 ms, so the slave stays on the v2 link
+#define LINK_RESYNC_ERRORS 3
+
+#define LINK_V1          0
+#define LINK_QUERYING    1
+#define LINK_SWITCHING   2
+#define LINK_PROBING     3
+#define LINK_READY       4
+#define LINK_RESYNCING   5
+
+/* Counters of REG_LINK_ERRORS, for each bus */
+#define LINK_ERROR_SLAVE_UART      0
+#define LINK_ERROR_SLAVE_TIMEOUT   1
+#define LINK_ERROR_SLAVE_NOISE     2
+#define LINK_ERROR_SLAVE_CRC       3
+#define LINK_ERROR_UART            4
+#define LINK_ERROR_NOISE           5
+#define LINK_ERRORS_PER_BUS        6
+
+uint8_t cmd_link_info[3] = {'r', 'g', 'v'};       // Command
+uint8_t cmd_link_speed[4] = {'r', 'g', 'u', 0};   // Command and speed
+uint8_t cmd_link_health[3] = {'r', 'g', 'z'};     // Command
+
+uint8_t link_version[2] = {1, 1};
+uint8_t link_state[2] = {LINK_V1, LINK_V1};
+uint8_t link_speed[2] = {GM_LINK_1MBPS, GM_LINK_1MBPS};  // Speed in use, or being tried
+uint8_t link_max_speed[2];                                // Fastest speed still to try
+uint8_t link_wait_ms[2];
+uint8_t link_health_ms[2];
+bool link_health_pending[2] = {false, false};             // The last 'z' wasn't answered yet
+uint8_t link_trouble[2] = {0, 0};                         // Reports with errors in a row
+uint8_t led_quarter_us[2] = {DISPLAY_QUARTER_US_PER_LED, DISPLAY_QUARTER_US_PER_LED};  // Time of each LED on the bus
+uint8_t link_buffer[16];                                  // Framing of a command
+
+static const uint8_t crc8_table[256] PROGMEM = {   // Polynomial 0x07
+   0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+   0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+   0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+   0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+   0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+   0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+   0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+   0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+   0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+   0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+   0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+   0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+   0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+   0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+   0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+   0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
+};
+
+#define crc8(crc, byte) pgm_read_byte(&crc8_table[(crc) ^ (byte)])
+
+/* Bytes of a command before its parameters */
+static uint8_t link_overhead (uint8_t bus)
+{
+   return (link_version[bus] == 1) ? 3 : 5;
+}
+
+/*
+* Writes the command with the framing of the bus, without the data that follows it.
+* Returns the size written.
+*/
+static uint8_t link_encode (uint8_t bus, uint8_t * dst, const uint8_t * cmd, uint8_t cmd_siz, const uint8_t * data, uint16_t data_siz)
+{
+   if (link_version[bus] == 1)
+   {
+      memcpy(dst, cmd, cmd_siz);
+      return cmd_siz;
+   }
+   
+   uint16_t length = cmd_siz - 3 + data_siz;
+   
+   uint8_t crc = crc8(0, cmd[2]);
+   crc = crc8(crc, length & 0xFF);
+   crc = crc8(crc, length >> 8);
+   for (uint8_t i = 3; i < cmd_siz; i++)
+      crc = crc8(crc, cmd[i]);
+   for (uint16_t i = 0; i < data_siz; i++)
+      crc = crc8(crc, data[i]);
+   
+   dst[0] = LINK_SYNC;
+   dst[1] = cmd[2];
+   dst[2] = length & 0xFF;
+   dst[3] = length >> 8;
+   dst[4] = crc;
+   memcpy(dst + 5, cmd + 3, cmd_siz - 3);
+   
+   return cmd_siz + 2;
+}
+
+static void link_xmit (uint8_t bus, const uint8_t * cmd, uint8_t cmd_siz, const uint8_t * data, uint16_t data_siz)
+{
+   uint8_t siz = link_encode(bus, link_buffer, cmd, cmd_siz, data, data_siz);
+   
+   if (bus == 0)
+   {
+      uart0_xmit(link_buffer, siz);
+      if (data_siz)
+         uart0_xmit(data, data_siz);
+   }
+   else
+   {
+      uart1_xmit(link_buffer, siz);
+      if (data_siz)
+         uart1_xmit(data, data_siz);
+   }
+}
+
+/*
+* BSEL is 0, so 1 Mb/s uses a BSCALE of 1, 2 Mb/s a BSCALE of 0 and 4 Mb/s the double speed.
+*/
+static void set_link_speed (uint8_t bus, uint8_t speed)
+{
+   USART_t * uart = (bus == 0) ? &UART0_UART : &UART1_UART;
+   
+   uart->BAUDCTRLA = 0;
+   uart->BAUDCTRLB = (speed == GM_LINK_1MBPS) ? (1 << 4) : 0;
+   
+   if (speed == GM_LINK_4MBPS)
+      uart->CTRLB |= USART_CLK2X_bm;
+   else
+      uart->CTRLB &= ~USART_CLK2X_bm;
+   
+   /* The slave may have lost the frame that was being sent */
+   shadow_valid &= (bus == 0) ? ~B_BUS0 : ~B_BUS1;
+}
+
+static void query_link (uint8_t bus)
+{
+   link_state[bus] = LINK_QUERYING;
+   link_wait_ms[bus] = 0;
+   link_health_ms[bus] = 0;
+   link_health_pending[bus] = false;
+   link_xmit(bus, cmd_link_info, 3, 0, 0);
+}
+
+void start_link (void)
+{
+   for (uint8_t bus = 0; bus < 2; bus++)
+   {
+      link_max_speed[bus] = app_regs.REG_LINK_SPEED;
+      link_trouble[bus] = 0;
+      query_link(bus);
+   }
+}
+
+/*
+* Without good frames the slave goes back to 1 Mb/s after 100 ms, so the link
+* is negotiated again after LINK_PROBE_MS.
+*/
+static void resync_link (uint8_t bus)
+{
+   set_link_speed(bus, GM_LINK_1MBPS);
+   link_version[bus] = 1;
+   link_speed[bus] = GM_LINK_1MBPS;
+   link_max_speed[bus] = app_regs.REG_LINK_SPEED;
+   
+   link_state[bus] = LINK_RESYNCING;
+   link_wait_ms[bus] = 0;
+   link_trouble[bus] = 0;
+   app_regs.REG_LINK_RESYNCS[bus]++;
+}
+
+/* While the link is being negotiated the errors are expected */
+static void count_link_trouble (uint8_t bus)
+{
+   if (link_state[bus] != LINK_V1 && link_state[bus] != LINK_READY)
+      return;
+   
+   if (++link_trouble[bus] >= LINK_RESYNC_ERRORS)
+      resync_link(bus);
+}
+
+void link_info_was_received (uint8_t bus, uint8_t version, uint8_t max_speed, uint8_t quarter_us_per_led)
+{
+   if (link_state[bus] == LINK_QUERYING)
+   {
+      if (version < 2)
+      {
+         link_state[bus] = LINK_V1;
+         return;
+      }
+      
+      led_quarter_us[bus] = quarter_us_per_led;
+      
+      link_speed[bus] = (max_speed < link_max_speed[bus]) ? max_speed : link_max_speed[bus];
+      link_state[bus] = LINK_SWITCHING;
+      link_wait_ms[bus] = 0;
+      
+      cmd_link_speed[3] = link_speed[bus];
+      link_xmit(bus, cmd_link_speed, 4, 0, 0);
+   }
+   else if (link_state[bus] == LINK_PROBING)
+   {
+      link_state[bus] = LINK_READY;
+   }
+}
+
+/* The slave is already on the new speed, so the probe goes with it */
+void link_switch_was_acked (uint8_t bus)
+{
+   if (link_state[bus] != LINK_SWITCHING)
+      return;
+   
+   set_link_speed(bus, link_speed[bus]);
+   link_version[bus] = 2;
+   
+   link_state[bus] = LINK_PROBING;
+   link_wait_ms[bus] = 0;
+   link_xmit(bus, cmd_link_info, 3, 0, 0);
+}
+
+/* The slave dropped a command with a bad CRC */
+void link_error_was_received (uint8_t bus)
+{
+   shadow_valid &= (bus == 0) ? ~B_BUS0 : ~B_BUS1;
+   count_link_trouble(bus);
+}
+
+/* The errors of the slave since the last report */
+void link_health_was_received (uint8_t bus, uint8_t * errors)
+{
+   uint32_t * counters = app_regs.REG_LINK_ERRORS + bus * LINK_ERRORS_PER_BUS;
+   bool clean = true;
+   
+   counters[LINK_ERROR_SLAVE_UART] += errors[0];
+   counters[LINK_ERROR_SLAVE_TIMEOUT] += errors[1];
+   counters[LINK_ERROR_SLAVE_NOISE] += errors[2];
+   counters[LINK_ERROR_SLAVE_CRC] += errors[3];
+   
+   for (uint8_t i = 0; i < 4; i++)
+      if (errors[i])
+         clean = false;
+   
+   link_health_pending[bus] = false;
+   
+   if (clean)
+      link_trouble[bus] = 0;
+   else
+      count_link_trouble(bus);
+}
+
+/* Framing error or overrun on the events of the slave */
+void link_uart_error_was_seen (uint8_t bus)
+{
+   app_regs.REG_LINK_ERRORS[bus * LINK_ERRORS_PER_BUS + LINK_ERROR_UART]++;
+   count_link_trouble(bus);
+}
+
+/* A byte that isn't an event of the slave */
+void link_noise_was_received (uint8_t bus)
+{
+   app_regs.REG_LINK_ERRORS[bus * LINK_ERRORS_PER_BUS + LINK_ERROR_NOISE]++;
+   count_link_trouble(bus);
+}
+
+void clear_link_errors (void)
+{
+   for (uint8_t i = 0; i < 2 * LINK_ERRORS_PER_BUS; i++)
+      app_regs.REG_LINK_ERRORS[i] = 0;
+}
+
+static void check_link_health (uint8_t bus)
+{
+   if (++link_health_ms[bus] < LINK_HEALTH_MS)
+      return;
+   
+   link_health_ms[bus] = 0;
+   
+   if (link_health_pending[bus])
+      count_link_trouble(bus);
+   
+   if (link_state[bus] == LINK_READY)
+   {
+      link_health_pending[bus] = true;
+      link_xmit(bus, cmd_link_health, 3, 0, 0);
+   }
+}
+
+static void check_link (void)
+{
+   for (uint8_t bus = 0; bus < 2; bus++)
+   {
+      if (link_state[bus] == LINK_READY)
+         check_link_health(bus);
+      
+      if (link_state[bus] == LINK_V1 || link_state[bus] == LINK_READY)
+         continue;
+      
+      link_wait_ms[bus]++;
+      
+      if (link_state[bus] == LINK_RESYNCING && link_wait_ms[bus] >= LINK_PROBE_MS)
+      {
+         query_link(bus);
+         continue;
+      }
+      
+      /* A slave without the v2 framing doesn't reply, the link stays as it is */
+      if ((link_state[bus] == LINK_QUERYING || link_state[bus] == LINK_SWITCHING) && link_wait_ms[bus] >= LINK_REPLY_MS)
+      {
+         link_state[bus] = (link_version[bus] == 2) ? LINK_READY : LINK_V1;
+      }
+      
+      /* By now the slave went back to the 'r' 'g' commands at 1 Mb/s */
+      if (link_state[bus] == LINK_PROBING && link_wait_ms[bus] >= LINK_PROBE_MS)
+      {
+         set_link_speed(bus, GM_LINK_1MBPS);
+         link_version[bus] = 1;
+         
+         if (link_speed[bus] == GM_LINK_1MBPS)
+         {
+            link_state[bus] = LINK_V1;
+         }
+         else
+         {
+            link_max_speed[bus] = link_speed[bus] - 1;
+            link_speed[bus] = GM_LINK_1MBPS;
+            query_link(bus);
+         }
+      }
+   }
+}
+
+uint8_t link_status (uint8_t bus)
+{
+   uint8_t status = (link_version[bus] == 2) ? (link_speed[bus] | B_LINK_V2) : GM_LINK_1MBPS;
+   
+   if (link_state[bus] != LINK_V1 && link_state[bus] != LINK_READY)
+      status |= B_LINK_BUSY;
+   
+   return status;
+}
+
+/************************************************************************/
+/* Frame pipeline                                                       */
+/************************************************************************/
+/*
+* The frame sent to the buses is followed through the load, the update pulse
+* and the LEDS_UPDATED of the slave. The Harp timestamp gives 32 us of resolution.
+*/
+#define PIPE_IDLE       0
+#define PIPE_LOADING    1
+#define PIPE_LOADED     2
+#define PIPE_UPDATING   3
+
+#define STAGE_LOAD      0     // From sent to LOAD_DONE
+#define STAGE_WAIT      1     // From LOAD_DONE to the update pulse
+#define STAGE_SHOW      2     // From the update pulse to LEDS_UPDATED
+#define STAGE_TOTAL     3     // From sent to LEDS_UPDATED
+
+#define FRAMES_RECEIVED    0
+#define FRAMES_DISPLAYED   1
+#define FRAMES_DROPPED     2
+
+uint8_t pipe_stage = PIPE_IDLE;
+uint8_t pipe_buses = 0;
+uint32_t pipe_sent_us;
+uint32_t pipe_loaded_us;
+uint32_t pipe_updated_us;
+uint32_t latency_samples = 0;
+
+static uint32_t pipeline_time_us (void)
+{
+   uint32_t seconds;
+   uint16_t micro;
+   
+   /* The second may change between both reads */
+   do {
+      seconds = core_func_read_R_TIMESTAMP_SECOND();
+      micro = core_func_read_R_TIMESTAMP_MICRO();
+   } while (seconds != core_func_read_R_TIMESTAMP_SECOND());
+   
+   return seconds * 1000000 + (uint32_t)micro * 32;
+}
+
+static void add_latency (uint8_t stage, uint32_t us)
+{
+   uint32_t * stats = app_regs.REG_LATENCY_STATS + stage * 3;
+   
+   if (latency_samples == 0)
+   {
+      stats[0] = us;
+      stats[1] = us;
+      stats[2] = us;
+      return;
+   }
+   
+   if (us < stats[0]) stats[0] = us;
+   if (us > stats[1]) stats[1] = us;
+   
+   /* Rolling mean over the last 8 frames or so */
+   stats[2] = (int32_t)stats[2] + ((int32_t)us - (int32_t)stats[2]) / 8;
+}
+
+void frame_was_received (void)
+{
+   app_regs.REG_FRAME_COUNTERS[FRAMES_RECEIVED]++;
+}
+
+/* A frame that replaces the one on the pipeline before its update drops it */
+static void frame_was_sent (uint8_t buses)
+{
+   if (pipe_stage == PIPE_LOADING || pipe_stage == PIPE_LOADED)
+   {
+      if (pipe_buses & buses)
+      {
+         app_regs.REG_FRAME_COUNTERS[FRAMES_DROPPED]++;
+      }
+      else
+      {
+         /* The other bus joins the frame on the pipeline */
+         pipe_buses |= buses;
+         pipe_stage = PIPE_LOADING;
+         return;
+      }
+   }
+   
+   pipe_sent_us = pipeline_time_us();
+   pipe_buses = buses;
+   pipe_stage = PIPE_LOADING;
+}
+
+/* The frame cleared from the queues is counted by the queue */
+static void forget_frame (void)
+{
+   if (pipe_stage != PIPE_UPDATING)
+      pipe_stage = PIPE_IDLE;
+}
+
+void frame_was_loaded (void)
+{
+   if (pipe_stage != PIPE_LOADING)
+      return;
+   
+   pipe_loaded_us = pipeline_time_us();
+   pipe_stage = PIPE_LOADED;
+}
+
+static void frame_was_updated (void)
+{
+   if (pipe_stage != PIPE_LOADED)
+      return;
+   
+   pipe_updated_us = pipeline_time_us();
+   pipe_stage = PIPE_UPDATING;
+}
+
+void frame_was_displayed (void)
+{
+   if (pipe_stage != PIPE_UPDATING)
+      return;
+   
+   uint32_t total = pipeline_time_us() - pipe_sent_us;
+   
+   add_latency(STAGE_LOAD, pipe_loaded_us - pipe_sent_us);
+   add_latency(STAGE_WAIT, pipe_updated_us - pipe_loaded_us);
+   add_latency(STAGE_SHOW, total - (pipe_updated_us - pipe_sent_us));
+   add_latency(STAGE_TOTAL, total);
+   latency_samples++;
+   
+   uint32_t bucket = total / 1000;
+   app_regs.REG_LATENCY_HISTOGRAM[bucket < 15 ? bucket : 15]++;
+   
+   app_regs.REG_FRAME_COUNTERS[FRAMES_DISPLAYED]++;
+   pipe_stage = PIPE_IDLE;
+}
+
+void clear_latencies (void)
+{
+   for (uint8_t i = 0; i < 12; i++)
+      app_regs.REG_LATENCY_STATS[i] = 0;
+   
+   for (uint8_t i = 0; i < 16; i++)
+      app_regs.REG_LATENCY_HISTOGRAM[i] = 0;
+   
+   latency_samples = 0;
+}
+
+/*
+* Encodes the LEDs that changed since the shadow frame as stream parts, 's', followed by
+* the stream commit, 'l'. Returns 0 if it isn't shorter than the command with the whole frame.
+*/
+static uint8_t encode_frame_diff (uint8_t bus, uint8_t * rgb, uint8_t * shadow, uint8_t leds)
+{
+   uint8_t siz = 0;
+   uint8_t led = 0;
+   uint8_t overhead = link_overhead(bus);
+   
+   while (led < leds)
+   {
+      if (memcmp(rgb + led*3, shadow + led*3, 3) == 0)
+      {
+         led++;
+         continue;
+      }
+      
+      /* A new part costs the same as 2 LEDs, so the part only ends after 3 unchanged LEDs */
+      uint8_t first = led;
+      uint8_t last = led;
+      
+      for (led++; led < leds && led - last < 3; led++)
+         if (memcmp(rgb + led*3, shadow + led*3, 3))
+            last = led;
+      
+      uint8_t count = last - first + 1;
+      
+      if (siz + (overhead + 3) + count*3 + (overhead + 2) >= (overhead + 1) + leds*3)
+         return 0;
+      
+      cmd_page[3] = first;
+      cmd_page[4] = 0;
+      cmd_page[5] = count;
+      siz += link_encode(bus, frame_scratch + siz, cmd_page, 6, rgb + first*3, count*3);
+      memcpy(frame_scratch + siz, rgb + first*3, count*3);
+      siz += count*3;
+   }
+   
+   cmd_commit[3] = leds;
+   cmd_commit[4] = 0;
+   siz += link_encode(bus, frame_scratch + siz, cmd_commit, 5, 0, 0);
+   
+   return siz;
+}
+
+/*
+* Encodes the frame as runs of LEDs with the same color, [count][R][G][B] each, for
+* the 'n' command. Returns 0 if it isn't shorter than the whole frame.
+* Without runs, only the size is found.
+*/
+static uint8_t encode_frame_runs (uint8_t * runs, uint8_t * rgb, uint8_t leds)
+{
+   uint8_t siz = 0;
+   
+   /* With the strips, the slaves expand each run LED by LED when it's received */
+   if (cmd_strips[3] > 1)
+      return 0;
+   
+   for (uint8_t led = 0; led < leds; )
+   {
+      uint8_t count = 1;
+      
+      while (led + count < leds && memcmp(rgb + led*3, rgb + (led + count)*3, 3) == 0)
+         count++;
+      
+      if (siz + 4 >= leds*3)
+         return 0;
+      
+      if (runs)
+      {
+         runs[siz] = count;
+         memcpy(runs + siz + 1, rgb + led*3, 3);
+      }
+      siz += 4;
+      led += count;
+   }
+   
+   return siz;
+}
+
+/*
+* Sends only the LEDs that changed, the runs of the frame or the whole frame,
+* the one that is shorter. Returns UART0_FRAME_QUEUED, UART0_FRAME_REPLACED or
+* UART0_FRAME_DROPPED, which both UARTs share.
+* The runs are only encoded once the changed LEDs lost, as both use frame_scratch.
+*/
+static uint8_t send_frame (uint8_t bus)
+{
+   uint8_t * rgb = app_regs.REG_COLOR_ARRAY + bus * 96;
+   uint8_t leds = app_regs.REG_LEDS_ON_BUS;
+   uint8_t bus_mask = (bus == 0) ? B_BUS0 : B_BUS1;
+   uint8_t runs_siz = encode_frame_runs(0, rgb, leds);
+   uint8_t result;
+   
+   /* A frame still waiting on the buffer is better replaced by the whole new frame */
+   if ((shadow_valid & bus_mask) && app_regs.REG_EXTENDED_LEDS == 0 &&
+       !((bus == 0) ? uart0_frame_is_waiting() : uart1_frame_is_waiting()))
+   {
+      uint8_t siz = encode_frame_diff(bus, rgb, shadow_frame[bus], leds);
+      
+      if (siz && (runs_siz == 0 || siz < link_overhead(bus) + 1 + runs_siz) &&
+          ((bus == 0) ? uart0_xmit_whole(frame_scratch, siz) : uart1_xmit_whole(frame_scratch, siz)))
+      {
+         memcpy(shadow_frame[bus], rgb, leds*3);
+         return UART0_FRAME_QUEUED;
+      }
+   }
+   
+   uint8_t * data = rgb;
+   uint8_t data_siz = leds*3;
+   uint8_t header_siz;
+   
+   if (runs_siz)
+   {
+      encode_frame_runs(frame_scratch, rgb, leds);
+      cmd_runs[3] = runs_siz / 4;
+      data = frame_scratch;
+      data_siz = runs_siz;
+      header_siz = link_encode(bus, link_buffer, cmd_runs, 4, data, data_siz);
+   }
+   else
+   {
+      cmd_array[3] = leds;
+      header_siz = link_encode(bus, link_buffer, cmd_array, 4, data, data_siz);
+   }
+   
+   if (bus == 0)
+      result = uart0_xmit_frame(link_buffer, header_siz, data, data_siz);
+   else
+      result = uart1_xmit_frame(link_buffer, header_siz, data, data_siz);
+   
+   /* A dropped frame left the buffer untouched, so the shadow still holds */
+   if (result == UART0_FRAME_DROPPED)
+      return result;
+   
+   memcpy(shadow_frame[bus], rgb, leds*3);
+   shadow_valid |= bus_mask;
+   
+   return result;
+}
+
+/*
+* Only the buses that received a frame are loaded and updated.
+* Returns the buses the frame was queued on, a bus without room drops it.
+* A frame no bus had room for is left to the caller, which may send it again.
+*/
+static uint8_t send_frames (uint8_t buses)
+{
+   clr_DEMO_MODE0;   // Stop demonstration mode if active
+   clr_DEMO_MODE1;
+   
+   /* A frame still waiting on the buffers is replaced by the new one */
+   uint8_t queued = 0;
+   bool replaced = false;
+   bool dropped = false;
+   
+   for (uint8_t bus = 0; bus < 2; bus++)
+   {
+      uint8_t bus_mask = (bus == 0) ? B_BUS0 : B_BUS1;
+      
+      if (!(buses & bus_mask))
+         continue;
+      
+      uint8_t result = send_frame(bus);
+      
+      if (result == UART0_FRAME_DROPPED)
+      {
+         dropped = true;
+      }
+      else
+      {
+         queued |= bus_mask;
+         replaced |= (result == UART0_FRAME_REPLACED);
+      }
+   }
+   
+   /* No load will come from a bus that didn't queue the frame */
+   loads_pending |= queued;
+   
+   if (queued)
+      frame_was_sent(queued);
+   
+   if (replaced)
+      app_regs.REG_COALESCED_FRAMES++;
+   if (dropped && queued)
+      app_regs.REG_FRAME_COUNTERS[FRAMES_DROPPED]++;
+   
+   return queued;
+}
+
+void update_bus (uint8_t buses)
+{
+   frame_was_received();
+   
+   if (send_frames(buses) == 0)
+      app_regs.REG_FRAME_COUNTERS[FRAMES_DROPPED]++;
+}
+
+void update_bus_window (uint8_t bus, uint8_t first_led, uint8_t leds)
+{
+   clr_DEMO_MODE0;   // Stop demonstration mode if active
+   clr_DEMO_MODE1;
+   
+   frame_was_received();
+   frame_was_sent((bus == 0) ? B_BUS0 : B_BUS1);
+   
+   cmd_window[3] = first_led;
+   cmd_window[4] = leds;
+   
+   link_xmit(bus, cmd_window, 5, app_regs.REG_COLOR_ARRAY + bus*96 + first_led*3, leds*3);
+   
+   if (bus == 0)
+   {
+      loads_pending |= B_BUS0;
+      shadow_valid &= ~B_BUS0;
+   }
+   else
+   {
+      loads_pending |= B_BUS1;
+      shadow_valid &= ~B_BUS1;
+   }
+}
+
+void update_bus_scatter (uint8_t * list_bus0, uint8_t leds_bus0, uint8_t * list_bus1, uint8_t leds_bus1)
+{
+   clr_DEMO_MODE0;   // Stop demonstration mode if active
+   clr_DEMO_MODE1;
+   
+   frame_was_received();
+   frame_was_sent((leds_bus0 ? B_BUS0 : 0) | (leds_bus1 ? B_BUS1 : 0));
+   
+   if (leds_bus0)
+   {
+      cmd_scatter[3] = leds_bus0;
+      link_xmit(0, cmd_scatter, 4, list_bus0, leds_bus0*4);
+      loads_pending |= B_BUS0;
+      shadow_valid &= ~B_BUS0;
+   }
+   
+   if (leds_bus1)
+   {
+      cmd_scatter[3] = leds_bus1;
+      link_xmit(1, cmd_scatter, 4, list_bus1, leds_bus1*4);
+      loads_pending |= B_BUS1;
+      shadow_valid &= ~B_BUS1;
+   }
+}
+
+/*
+* The indexes are sent with 4 bits when all of them fit, the first LED on the high nibble.
+* Returns the bits used.
+*/
+static uint8_t pack_indexes (uint8_t * packed, uint8_t * indexes, uint8_t leds)
+{
+   for (uint8_t led = 0; led < leds; led++)
+   {
+      if (indexes[led] >= 16)
+      {
+         memcpy(packed, indexes, leds);
+         return 8;
+      }
+   }
+   
+   for (uint8_t led = 0; led < leds; led += 2)
+      packed[led >> 1] = (indexes[led] << 4) | ((led + 1 < leds) ? indexes[led + 1] : 0);
+   
+   return 4;
+}
+
+static void xmit_indexes (uint8_t bus, uint8_t * cmd, uint8_t * indexes)
+{
+   uint8_t packed[32];
+   uint8_t leds = app_regs.REG_LEDS_ON_BUS;
+   
+   cmd[3] = pack_indexes(packed, indexes, leds);
+   cmd[4] = leds;
+   
+   link_xmit(bus, cmd, 5, packed, (cmd[3] == 8) ? leds : (leds + 1) >> 1);
+}
+
+/*
+* The slaves expand the indexes with their palette, so the colors are also
+* expanded here to keep REG_COLOR_ARRAY with the frame being shown.
+*/
+void update_bus_indexed (uint8_t * indexes)
+{
+   clr_DEMO_MODE0;   // Stop demonstration mode if active
+   clr_DEMO_MODE1;
+   
+   frame_was_received();
+   frame_was_sent(B_BUS0 | B_BUS1);
+   
+   for (uint8_t led = 0; led < 64; led++)
+      memcpy(app_regs.REG_COLOR_ARRAY + led*3, app_regs.REG_PALETTE + indexes[led]*3, 3);
+   
+   xmit_indexes(0, cmd_indexed, indexes);
+   xmit_indexes(1, cmd_indexed, indexes + 32);
+   
+   loads_pending |= B_BUS0 | B_BUS1;
+   shadow_valid = 0;
+}
+
+void start_demo_mode (void)
+{
+   uint8_t leds_on_bus = short_leds_on_bus();
+   
+   set_DEMO_MODE0;
+   set_DEMO_MODE1;
+   
+   link_xmit(0, cmd_demo, 3, &leds_on_bus, 1);
+   link_xmit(1, cmd_demo, 3, &leds_on_bus, 1);
+}
+
+void define_off_values (uint8_t red, uint8_t green, uint8_t blue)
+{
+   clr_DEMO_MODE0;   // Stop demonstration mode if active
+   clr_DEMO_MODE1;
+   
+   cmd_off[3] = short_leds_on_bus();
+   uint8_t rgb[3] = {red, green, blue};
+   
+   link_xmit(0, cmd_off, 4, rgb, 3);
+   link_xmit(1, cmd_off, 4, rgb, 3);
+}
+
+void define_strips (void)
+{
+   /* Only the strips up to the last one with LEDs are sent */
+   cmd_strips[3] = 0;
+   for (uint8_t i = 0; i < 8; i++)
+      if (app_regs.REG_STRIP_LEDS[i])
+         cmd_strips[3] = i + 1;
+   
+   link_xmit(0, cmd_strips, 4, app_regs.REG_STRIP_LEDS, cmd_strips[3]);
+   link_xmit(1, cmd_strips, 4, app_regs.REG_STRIP_LEDS, cmd_strips[3]);
+}
+
+void append_sequence_frame (uint8_t * rgb)
+{
+   clr_DEMO_MODE0;   // Stop demonstration mode if active
+   clr_DEMO_MODE1;
+   
+   cmd_store[3] = app_regs.REG_LEDS_ON_BUS;
+   
+   link_xmit(0, cmd_store, 4, rgb, cmd_store[3] * 3);
+   link_xmit(1, cmd_store, 4, rgb + 96, cmd_store[3] * 3);
+}
+
+void append_sequence_palette_frame (uint8_t * indexes)
+{
+   clr_DEMO_MODE0;   // Stop demonstration mode if active
+   clr_DEMO_MODE1;
+   
+   xmit_indexes(0, cmd_store_indexed, indexes);
+   xmit_indexes(1, cmd_store_indexed, indexes + 32);
+}
+
+void define_palette (void)
+{
+   link_xmit(0, cmd_palette, 5, app_regs.REG_PALETTE, PALETTE_ENTRIES * 3);
+   link_xmit(1, cmd_palette, 5, app_regs.REG_PALETTE, PALETTE_ENTRIES * 3);
+}
+
+void control_sequence (uint8_t command)
+{
+   if (command & B_SEQ_CLEAR)
+   {
+      sequence_frames[0] = 0;
+      sequence_frames[1] = 0;
+   }
+   
+   cmd_sequence[3] = command;
+   
+   link_xmit(0, cmd_sequence, 4, 0, 0);
+   link_xmit(1, cmd_sequence, 4, 0, 0);
+}
+
+void define_brightness (void)
+{
+   cmd_brightness[3] = app_regs.REG_BRIGHTNESS;
+   
+   link_xmit(0, cmd_brightness, 4, 0, 0);
+   link_xmit(1, cmd_brightness, 4, 0, 0);
+}
+
+void define_gamma (void)
+{
+   cmd_gamma[3] = app_regs.REG_GAMMA;
+   
+   link_xmit(0, cmd_gamma, 4, 0, 0);
+   link_xmit(1, cmd_gamma, 4, 0, 0);
+}
+
+void start_effect (void)
+{
+   clr_DEMO_MODE0;   // Stop demonstration mode if active
+   clr_DEMO_MODE1;
+   
+   link_xmit(0, cmd_effect, 3, app_regs.REG_EFFECT, 6);
+   link_xmit(1, cmd_effect, 3, app_regs.REG_EFFECT, 6);
+}
+
+void define_fade_duration (void)
+{
+   cmd_fade[3] = app_regs.REG_FADE_DURATION & 0xFF;
+   cmd_fade[4] = app_regs.REG_FADE_DURATION >> 8;
+   
+   link_xmit(0, cmd_fade, 5, 0, 0);
+   link_xmit(1, cmd_fade, 5, 0, 0);
+}
+
+/*
+* The page is only loaded by the slave, the commit shows the frame on both buses.
+*/
+void update_bus_page (uint8_t bus, uint16_t first_led, uint8_t leds, uint8_t * rgb, bool commit)
+{
+   clr_DEMO_MODE0;   // Stop demonstration mode if active
+   clr_DEMO_MODE1;
+   
+   shadow_valid = 0;
+   
+   cmd_page[3] = first_led & 0xFF;
+   cmd_page[4] = first_led >> 8;
+   cmd_page[5] = leds;
+   
+   if (leds)
+   {
+      link_xmit(bus, cmd_page, 6, rgb, leds*3);
+   }
+   
+   if (commit)
+   {
+      cmd_commit[3] = app_regs.REG_EXTENDED_LEDS & 0xFF;
+      cmd_commit[4] = app_regs.REG_EXTENDED_LEDS >> 8;
+      
+      link_xmit(0, cmd_commit, 5, 0, 0);
+      link_xmit(1, cmd_commit, 5, 0, 0);
+      loads_pending |= B_BUS0 | B_BUS1;
+      
+      frame_was_received();
+      frame_was_sent(B_BUS0 | B_BUS1);
+   }
+}
+
+void stop_demo_mode (void)
+{
+   clr_DEMO_MODE0;
+   clr_DEMO_MODE1;
+}
+
+/************************************************************************/
+/* DO pulses                                                            */
+/************************************************************************/
+// TCC0 runs free with 8 us per count. The compare channels A and B end the
+// 1 ms pulses of DO0 and DO1, so TCD0 is left to measure the update latency.
+#define DO_PULSE_COUNTS 125
+
+void start_do_pulse (uint8_t output)
+{
+   uint8_t sreg = SREG;
+   cli();
+   
+   if (output == 0)
+   {
+      set_DO0;
+      TCC0.CCA = TCC0.CNT + DO_PULSE_COUNTS;
+      TCC0.INTFLAGS = TC0_CCAIF_bm;
+      TCC0.INTCTRLB = (TCC0.INTCTRLB & ~TC0_CCAINTLVL_gm) | TC_CCAINTLVL_LO_gc;
+   }
+   else
+   {
+      set_DO1;
+      TCC0.CCB = TCC0.CNT + DO_PULSE_COUNTS;
+      TCC0.INTFLAGS = TC0_CCBIF_bm;
+      TCC0.INTCTRLB = (TCC0.INTCTRLB & ~TC0_CCBINTLVL_gm) | TC_CCBINTLVL_LO_gc;
+   }
+   
+   SREG = sreg;
+}
+
+/* Called by the compare channels of TCC0, on the low level */
+void do_pulse_was_ended (uint8_t output)
+{
+   uint8_t sreg = SREG;
+   cli();
+   
+   if (output == 0)
+   {
+      clr_DO0;
+      TCC0.INTCTRLB &= ~TC0_CCAINTLVL_gm;
+   }
+   else
+   {
+      clr_DO1;
+      TCC0.INTCTRLB &= ~TC0_CCBINTLVL_gm;
+   }
+   
+   SREG = sreg;
+}
+
+/************************************************************************/
+/* TCE0                                                                 */
+/************************************************************************/
+// TCE0 runs free with 4 counts per us. The compare channel A times the scheduled
+// frames and the compare channel B the pulse train. Their ISRs run on the high level
+// and only make the edge on the pins, the rest is left to the compare channel C,
+// set a few counts ahead on the low level.
+#define TCE0_COUNTS_PER_US 4
+
+#define TCE0_LATER_COUNTS    2
+#define LATER_PRESENTATION   (1<<0)
+#define LATER_PULSE_ON       (1<<1)
+#define LATER_PULSE_OFF      (1<<2)
+
+uint8_t tce0_later = 0;          // Work left by the edges for the low level
+
+/* The ISRs of the high level also change the levels of TCE0 */
+static void set_tce0_int_level (uint8_t group_mask, uint8_t level)
+{
+   uint8_t sreg = SREG;
+   cli();
+   TCE0.INTCTRLB = (TCE0.INTCTRLB & ~group_mask) | level;
+   SREG = sreg;
+}
+
+static void do_later (uint8_t work)
+{
+   tce0_later |= work;
+   TCE0.CCC = TCE0.CNT + TCE0_LATER_COUNTS;
+   TCE0.INTFLAGS = TC0_CCCIF_bm;
+   set_tce0_int_level(TC0_CCCINTLVL_gm, TC_CCCINTLVL_LO_gc);
+}
+
+/************************************************************************/
+/* Latch skew                                                           */
+/************************************************************************/
+/*
+* Both slaves report LEDS_UPDATED when they sent the last LED, so the time
+* between both reports is the skew of the latches. It's measured with TCE0,
+* so skews above 16 ms are not told apart.
+*/
+uint8_t skew_buses = 0;                         // Buses that reported since the last update pulse
+uint16_t skew_first_count;
+bool skew_measured = false;
+
+void measure_latch_skew (uint8_t bus)
+{
+   uint16_t count = TCE0.CNT;
+   
+   if (skew_buses == 0)
+   {
+      skew_first_count = count;
+      skew_buses = bus;
+      return;
+   }
+   
+   if (skew_buses & bus)
+      return;
+   
+   skew_buses |= bus;
+   
+   int16_t skew = (uint16_t)(count - skew_first_count) / TCE0_COUNTS_PER_US;
+   if (bus == B_BUS0)
+      skew = -skew;
+   
+   app_regs.REG_LATCH_SKEW[0] = skew;
+   
+   if (!skew_measured || skew < app_regs.REG_LATCH_SKEW[1]) app_regs.REG_LATCH_SKEW[1] = skew;
+   if (!skew_measured || skew > app_regs.REG_LATCH_SKEW[2]) app_regs.REG_LATCH_SKEW[2] = skew;
+   skew_measured = true;
+}
+
+void clear_latch_skew (void)
+{
+   for (uint8_t i = 0; i < 3; i++)
+      app_regs.REG_LATCH_SKEW[i] = 0;
+   
+   skew_measured = false;
+}
+
+/************************************************************************/
+/* Display time                                                         */
+/************************************************************************/
+/*
+* The timestamp is taken at the update pulse and moved forward by the time the
+* slaves take to send the frame. It's sent with the LEDS_UPDATED of the slave,
+* once the frame is known to be on the LEDs.
+* Each slave tells the time of its LEDs on the link info, which depends on its
+* output engine, and the slower one counts.
+*/
+uint32_t display_seconds = 0;
+uint16_t display_useconds = 0;                  // Units of 32 us, as the Harp timestamp
+
+static uint32_t time_to_display (void)
+{
+   uint16_t leds = app_regs.REG_EXTENDED_LEDS ? app_regs.REG_EXTENDED_LEDS : app_regs.REG_LEDS_ON_BUS;
+   uint8_t quarter_us = (led_quarter_us[0] > led_quarter_us[1]) ? led_quarter_us[0] : led_quarter_us[1];
+   
+   /* The parallel strips are sent together, so the longest one counts */
+   uint8_t longest_strip = 0;
+   for (uint8_t i = 0; i < 8; i++)
+      if (app_regs.REG_STRIP_LEDS[i] > longest_strip)
+         longest_strip = app_regs.REG_STRIP_LEDS[i];
+   
+   /* The strips are shown right away, without the crossfade */
+   if (longest_strip)
+      return DISPLAY_LATCH_US + longest_strip * DISPLAY_US_PER_STRIP_LED;
+   
+   /* With the crossfade the frame is only fully shown at its end */
+   return DISPLAY_LATCH_US + ((uint32_t)leds * quarter_us) / 4 + (uint32_t)app_regs.REG_FADE_DURATION * 1000;
+}
+
+/* Call it right after the update pulse */
+void mark_display_time (void)
+{
+   frame_was_updated();
+   skew_buses = 0;
+   
+   core_func_mark_user_timestamp();
+   core_func_read_user_timestamp(&display_seconds, &display_useconds);
+   
+   uint32_t display_us = time_to_display();
+   uint32_t units = display_useconds + (display_us + 16) / 32;
+   
+   app_regs.REG_DISPLAY_TIME = (display_us > 0xFFFF) ? 0xFFFF : display_us;
+   
+   display_seconds += units / 31250;
+   display_useconds = units % 31250;
+}
+
+void report_display_time (void)
+{
+   if (app_regs.REG_EVNT_ENABLE & B_EVT_DISPLAY_TIME)
+   {
+      core_func_update_user_timestamp(display_seconds, display_useconds);
+      core_func_send_event(ADD_REG_DISPLAY_TIME, false);
+   }
+}
+
+/************************************************************************/
+/* Scheduled frames                                                     */
 /************************************************************************/
-static const uint8_t default_device_name[] = "RgbArray";
+/*
+* The frames wait on a queue and are loaded one at a time. Once loaded, the 1 ms
+* callback arms TCE0 on the last 2 ms, which updates the LEDs at the presentation time.
+* The queue holds a single frame, since the core leaves little SRAM.
+*/
+#define PRESENTATION_QUEUE_SIZE 1
 
-void hwbp_app_initialize(void)
+#define PRESENTATION_IDLE     0
+#define PRESENTATION_LOADING  1
+#define PRESENTATION_LOADED   2
+#define PRESENTATION_ARMED    3
+
+typedef struct
 {
-	   /* Define versions */
-    uint8_t hwH = 1;
-    uint8_t hwL = 0;
-    uint8_t fwH = 2;
-    uint8_t fwL = 0;
-    uint8_t ass = 0;
-    
-   	/* Start core */
-    core_func_start_core(
-        1264,
-        hwH, hwL,
-        fwH, fwL,
-        ass,
-        (uint8_t*)(&app_regs),
-        APP_NBYTES_OF_REG_BANK,
-        APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1,
-		default_device_name,
-		false,	// The device is _not_ able to repeat the harp timestamp clock
-		false	// The device is _not_ able to generate the harp timestamp clock
-    );
+   uint32_t seconds;
+   uint32_t useconds;
+   uint8_t rgb[192];
+} presentation_t;
+
+presentation_t presentation_queue[PRESENTATION_QUEUE_SIZE];
+uint8_t presentation_first = 0;
+uint8_t presentation_count = 0;
+uint8_t presentation_state = PRESENTATION_IDLE;
+
+static void load_presentation (void)
+{
+   if (presentation_count == 0)
+   {
+      presentation_state = PRESENTATION_IDLE;
+      return;
+   }
+   
+   memcpy(app_regs.REG_COLOR_ARRAY, presentation_queue[presentation_first].rgb, 192);
+   
+   /* A frame none of the buses had room for is sent again by retry_frame_loads() */
+   if (send_frames(B_BUS0 | B_BUS1))
+      presentation_state = PRESENTATION_LOADING;
+   else
+      presentation_state = PRESENTATION_IDLE;
+}
+
+bool schedule_frame (uint32_t seconds, uint32_t useconds, uint8_t * rgb)
+{
+   if (presentation_count == PRESENTATION_QUEUE_SIZE)
+      return false;
+   
+   presentation_t * frame = &presentation_queue[(presentation_first + presentation_count) % PRESENTATION_QUEUE_SIZE];
+   frame->seconds = seconds;
+   frame->useconds = useconds;
+   memcpy(frame->rgb, rgb, 192);
+   presentation_count++;
+   frame_was_received();
+   
+   if (presentation_state == PRESENTATION_IDLE)
+      load_presentation();
+   
+   return true;
+}
+
+void clear_scheduled_frames (void)
+{
+   set_tce0_int_level(TC0_CCAINTLVL_gm, 0);
+   
+   if (presentation_state != PRESENTATION_IDLE)
+      forget_frame();
+   
+   app_regs.REG_FRAME_COUNTERS[FRAMES_DROPPED] += presentation_count;
+   presentation_count = 0;
+   presentation_state = PRESENTATION_IDLE;
+}
+
+/*
+* Called when the buses loaded a frame. Returns true if it's a scheduled frame,
+* which is only updated at its presentation time.
+*/
+bool presentation_was_loaded (void)
+{
+   if (presentation_state != PRESENTATION_LOADING)
+      return false;
+   
+   if (loads_pending == 0)
+      presentation_state = PRESENTATION_LOADED;
+   
+   return true;
+}
+
+static void presentation_was_shown (void)
+{
+   mark_display_time();
+   
+   /* The queue may have been cleared since the edge */
+   if (presentation_state != PRESENTATION_ARMED && presentation_state != PRESENTATION_LOADED)
+      return;
+   
+   presentation_first = (presentation_first + 1) % PRESENTATION_QUEUE_SIZE;
+   presentation_count--;
+   
+   load_presentation();
+}
+
+/* Called by the compare channel A, on the high level */
+void present_frame (void)
+{
+   TCE0.INTCTRLB &= ~TC0_CCAINTLVL_gm;
+   
+   set_UPDATE_LEDS0;
+   set_UPDATE_LEDS1;
+   clr_UPDATE_LEDS0;
+   clr_UPDATE_LEDS1;
+   
+   do_later(LATER_PRESENTATION);
+}
+
+/*
+* The timestamp is read with a resolution of 32 us.
+*/
+static void check_presentation_time (void)
+{
+   if (presentation_state != PRESENTATION_LOADED)
+      return;
+   
+   presentation_t * frame = &presentation_queue[presentation_first];
+   uint32_t seconds = core_func_read_R_TIMESTAMP_SECOND();
+   uint32_t useconds = core_func_read_R_TIMESTAMP_MICRO() * 32UL;
+   int32_t delta;
+   
+   if (frame->seconds > seconds + 1)
+      return;
+   
+   if (frame->seconds < seconds)
+      delta = 0;
+   else
+      delta = (int32_t)(frame->seconds - seconds) * 1000000L + (int32_t)frame->useconds - (int32_t)useconds;
+   
+   if (delta >= 2000)
+      return;
+   
+   /* A late frame is shown right away */
+   if (delta < 4)
+   {
+      set_UPDATE_LEDS0;
+      set_UPDATE_LEDS1;
+      clr_UPDATE_LEDS0;
+      clr_UPDATE_LEDS1;
+      presentation_was_shown();
+      return;
+   }
+   
+   presentation_state = PRESENTATION_ARMED;
+   TCE0.CCA = TCE0.CNT + delta * TCE0_COUNTS_PER_US;
+   TCE0.INTFLAGS = TC0_CCAIF_bm;
+   set_tce0_int_level(TC0_CCAINTLVL_gm, TC_CCAINTLVL_HI_gc);
 }
 
 /************************************************************************/
-/* Handle if a catastrophic error occur                                 */
+/* Frame ring                                                           */
 /************************************************************************/
-void core_callback_catastrophic_error_detected(void)
+/*
+* With DI0 on GM_DI0_STEP_FRAMES, the frame on the head of the ring is loaded ahead
+* of time, so a rising edge only needs to update the LEDs before the next one is loaded.
+* The core takes ~6.8 KB of the 8 KB of SRAM, so the ring only holds FRAME_RING_SIZE frames.
+*/
+uint8_t frame_ring[FRAME_RING_SIZE][192];
+
+bool ring_frame_loading = false;
+bool ring_frame_loaded = false;
+bool ring_was_cleared = false;
+
+static void load_ring_frame (void)
 {
-   clr_DEMO_MODE0;
-   clr_DEMO_MODE1;
+   if (app_regs.REG_DI0_CONF != GM_DI0_STEP_FRAMES || app_regs.REG_FRAME_RING_COUNT == 0)
+      return;
    
-   set_DISABLE_LEDS0;
-   set_DISABLE_LEDS1;
-   clr_DISABLE_LEDS0;
-   clr_DISABLE_LEDS1;
+   if (ring_frame_loading || ring_frame_loaded)
+      return;
    
-   clr_DO0;
-   clr_DO1;
-   clr_DO2;
-   clr_DO3;
-   clr_DO4;
+   memcpy(app_regs.REG_COLOR_ARRAY, frame_ring[app_regs.REG_FRAME_RING_HEAD], 192);
+   
+   /* A frame none of the buses had room for is sent again by retry_frame_loads() */
+   ring_frame_loading = (send_frames(B_BUS0 | B_BUS1) != 0);
+}
+
+bool append_ring_frame (uint8_t * rgb)
+{
+   if (app_regs.REG_FRAME_RING_COUNT == FRAME_RING_SIZE)
+      return false;
+   
+   memcpy(frame_ring[app_regs.REG_FRAME_RING_TAIL], rgb, 192);
+   app_regs.REG_FRAME_RING_TAIL = (app_regs.REG_FRAME_RING_TAIL + 1) % FRAME_RING_SIZE;
+   app_regs.REG_FRAME_RING_COUNT++;
+   frame_was_received();
+   
+   load_ring_frame();
+   
+   return true;
+}
+
+/*
+* The frames written to the buses meanwhile replaced the one loaded, so it's loaded again.
+*/
+void start_frame_ring (void)
+{
+   ring_frame_loaded = false;
+   load_ring_frame();
+}
+
+/*
+* A frame being loaded still reports the load, which is then ignored.
+*/
+void clear_frame_ring (void)
+{
+   if (ring_frame_loading || ring_frame_loaded)
+      forget_frame();
+   
+   app_regs.REG_FRAME_COUNTERS[FRAMES_DROPPED] += app_regs.REG_FRAME_RING_COUNT;
+   
+   app_regs.REG_FRAME_RING_COUNT = 0;
+   app_regs.REG_FRAME_RING_HEAD = 0;
+   app_regs.REG_FRAME_RING_TAIL = 0;
+   ring_frame_loaded = false;
+   
+   if (ring_frame_loading)
+      ring_was_cleared = true;
+}
+
+/*
+* Called when the buses loaded a frame. Returns true if it's the frame of the ring,
+* which is only updated with the next step.
+*/
+bool ring_frame_was_loaded (void)
+{
+   if (!ring_frame_loading)
+      return false;
+   
+   if (loads_pending == 0)
+   {
+      ring_frame_loading = false;
+      
+      if (ring_was_cleared)
+      {
+         ring_was_cleared = false;
+         load_ring_frame();
+      }
+      else
+      {
+         ring_frame_loaded = true;
+      }
+   }
+   
+   return true;
+}
+
+/*
+* A step before the frame is loaded is lost.
+*/
+void step_frame_ring (void)
+{
+   if (!ring_frame_loaded)
+      return;
+   
+   set_UPDATE_LEDS0;
+   set_UPDATE_LEDS1;
+   clr_UPDATE_LEDS0;
+   clr_UPDATE_LEDS1;
+   mark_display_time();
+   
+   ring_frame_loaded = false;
+   app_regs.REG_FRAME_RING_HEAD = (app_regs.REG_FRAME_RING_HEAD + 1) % FRAME_RING_SIZE;
+   app_regs.REG_FRAME_RING_COUNT--;
+   
+   load_ring_frame();
+}
+
+/*
+* Called every millisecond, sends again the frames the buses had no room for.
+*/
+static void retry_frame_loads (void)
+{
+   if (presentation_state == PRESENTATION_IDLE && presentation_count)
+      load_presentation();
+   
+   load_ring_frame();
 }
 
 /************************************************************************/
-/* General definitions                                                  */
+/* Update latency                                                       */
 /************************************************************************/
-// #define NBYTES 23
+/*
+* The latency is measured on the pins. TCD0 runs free at 32 MHz and captures DI0 on
+* the channel A, UPDATE_LEDS0 on B and UPDATE_LEDS1 on C, each from its own event
+* channel. The pin synchronizers add the same delay to the three captures.
+*/
+uint16_t update_latency_count = 0;     // Latencies measured since the last clear
+
+static void start_update_latency (void)
+{
+   EVSYS.CH4MUX = EVSYS_CHMUX_PORTA_PIN0_gc;
+   EVSYS.CH5MUX = EVSYS_CHMUX_PORTA_PIN6_gc;
+   EVSYS.CH6MUX = EVSYS_CHMUX_PORTC_PIN3_gc;
+   
+   /* The update lines are outputs, their input sense makes the events */
+   PORTA.PIN6CTRL = (PORTA.PIN6CTRL & ~PORT_ISC_gm) | PORT_ISC_RISING_gc;
+   PORTC.PIN3CTRL = (PORTC.PIN3CTRL & ~PORT_ISC_gm) | PORT_ISC_RISING_gc;
+   
+   TCD0.CTRLA = TC_CLKSEL_OFF_gc;
+   TCD0.CTRLFSET = TC_CMD_RESET_gc;
+   TCD0.PER = 0xFFFF;
+   TCD0.CTRLB = TC0_CCAEN_bm | TC0_CCBEN_bm | TC0_CCCEN_bm;
+   TCD0.CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH4_gc;
+   TCD0.INTCTRLB = TC_CCCINTLVL_LO_gc;
+   TCD0.CTRLA = TC_CLKSEL_DIV1_gc;
+}
+
+static void stop_update_latency (void)
+{
+   TCD0.CTRLA = TC_CLKSEL_OFF_gc;
+   TCD0.INTCTRLB = 0;
+   
+   EVSYS.CH4MUX = EVSYS_CHMUX_OFF_gc;
+   EVSYS.CH5MUX = EVSYS_CHMUX_OFF_gc;
+   EVSYS.CH6MUX = EVSYS_CHMUX_OFF_gc;
+}
+
+static void store_update_latency (uint16_t * reg, uint16_t counts)
+{
+   /* 31.25 ns per count */
+   uint32_t ns = ((uint32_t)counts * 125) >> 2;
+   uint16_t latency = (ns > 0xFFFF) ? 0xFFFF : ns;
+   
+   reg[0] = latency;
+   
+   if (update_latency_count == 0 || latency < reg[1]) reg[1] = latency;
+   if (update_latency_count == 0 || latency > reg[2]) reg[2] = latency;
+}
+
+/* Empties the buffer of a capture channel and keeps the last capture */
+static uint16_t last_capture (volatile uint16_t * cc, uint8_t flag)
+{
+   uint16_t count = *cc;
+   
+   while (TCD0.INTFLAGS & flag)
+      count = *cc;
+   
+   return count;
+}
+
+/*
+* Called by the capture of UPDATE_LEDS1, on the low level, after the one of UPDATE_LEDS0.
+* The pulses made by the CPU, without a capture of DI0 before them, are not measured.
+*/
+void update_latency_was_captured (void)
+{
+   bool from_di0 = TCD0.INTFLAGS & TC0_CCAIF_bm;
+   uint16_t edge = last_capture(&TCD0.CCA, TC0_CCAIF_bm);
+   uint16_t update0 = last_capture(&TCD0.CCB, TC0_CCBIF_bm);
+   uint16_t update1 = last_capture(&TCD0.CCC, TC0_CCCIF_bm);
+   
+   if (!from_di0)
+      return;
+   
+   store_update_latency(&app_regs.REG_UPDATE_LATENCY[0], update0 - edge);
+   store_update_latency(&app_regs.REG_UPDATE_LATENCY[3], update1 - edge);
+   
+   if (update_latency_count < 0xFFFF)
+      update_latency_count++;
+}
+
+void clear_update_latency (void)
+{
+   for (uint8_t i = 0; i < 6; i++)
+      app_regs.REG_UPDATE_LATENCY[i] = 0;
+   
+   update_latency_count = 0;
+}
 
 /************************************************************************/
-/* General used functions                                               */
+/* DI0 routed to the update lines                                       */
 /************************************************************************/
-uint8_t cmd_array[4] = {'r', 'g', 'b', 0};   // Command and REG_LEDS_ON_BUS/2
-uint8_t cmd_demo[4]  = {'r', 'g', 'c', 0};   // Command and REG_LEDS_ON_BUS/2
-uint8_t cmd_off[4]  = {'r', 'g', 'd', 0};   // Command and REG_LEDS_ON_BUS/2
+/*
+* A rising edge of DI0 is an event on the channel 0, which triggers the DMA channels 2
+* and 3. Each one writes its update line to OUTTGL twice, on a single burst, so the CPU
+* never sees it. From the datasheet timings of the pin synchronizer, the event routing and
+* the DMA cycles, the pulse on bus 0 starts ~250 ns after the edge and the one on bus 1
+* ~125 ns later, or one UART byte transfer later if the DMA of a UART is busy.
+* The latency of each edge is measured and kept on REG_UPDATE_LATENCY.
+*/
+static const uint8_t update_leds0_pulse[2] = {(1<<6), (1<<6)};
+static const uint8_t update_leds1_pulse[2] = {(1<<3), (1<<3)};
+
+static void enable_update_dma (volatile DMA_CH_t * ch, const uint8_t * pulse, volatile uint8_t * outtgl)
+{
+   ch->CTRLA = 0;
    
-void update_bus (void)
+   ch->SRCADDR0 = ((uint16_t)pulse) & 0xFF;
+   ch->SRCADDR1 = ((uint16_t)pulse) >> 8;
+   ch->SRCADDR2 = 0;
+   ch->DESTADDR0 = ((uint16_t)outtgl) & 0xFF;
+   ch->DESTADDR1 = ((uint16_t)outtgl) >> 8;
+   ch->DESTADDR2 = 0;
+   
+   ch->ADDRCTRL = DMA_CH_SRCRELOAD_BLOCK_gc | DMA_CH_SRCDIR_INC_gc | DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc;
+   ch->TRIGSRC = DMA_CH_TRIGSRC_EVSYS_CH0_gc;
+   ch->TRFCNT = 2;
+   ch->REPCNT = 0;   // Repeats forever
+   ch->CTRLA = DMA_CH_ENABLE_bm | DMA_CH_REPEAT_bm | DMA_CH_BURSTLEN_2BYTE_gc;
+}
+
+/*
+* Only the rising edges of DI0 can make events, so the falling edges are not sensed.
+*/
+void route_di0_to_updates (bool enable)
 {
-   clr_DEMO_MODE0;   // Stop demonstration mode if active
-   clr_DEMO_MODE1;
+   if (enable)
+   {
+      io_pin2in(&PORTA, 0, PULL_IO_UP, SENSE_IO_EDGE_RISING);           // DI0
       
-   cmd_array[3] = app_regs.REG_LEDS_ON_BUS;
-   
-   uart0_xmit(cmd_array, 4);
-   uart1_xmit(cmd_array, 4);
+      DMA.CTRL |= DMA_ENABLE_bm;
+      enable_update_dma(&DMA.CH2, update_leds0_pulse, &PORTA.OUTTGL);
+      enable_update_dma(&DMA.CH3, update_leds1_pulse, &PORTC.OUTTGL);
+      EVSYS.CH0MUX = EVSYS_CHMUX_PORTA_PIN0_gc;
+      
+      start_update_latency();
+   }
+   else
+   {
+      stop_update_latency();
+      
+      EVSYS.CH0MUX = EVSYS_CHMUX_OFF_gc;
+      DMA.CH2.CTRLA = 0;
+      DMA.CH3.CTRLA = 0;
+      
+      io_pin2in(&PORTA, 0, PULL_IO_UP, SENSE_IO_EDGES_BOTH);            // DI0
+   }
+}
+
+/************************************************************************/
+/* Pulse train                                                          */
+/************************************************************************/
+/*
+* Turns the LEDs on and off through REG_LEDS_STATUS, REG_PULSE_COUNT times. The times
+* longer than the counter of TCE0 are split in steps of 0x8000 counts.
+*/
+bool pulse_is_on = false;
+uint32_t pulse_counts_left = 0;
+
+static void advance_pulse_compare (uint16_t from)
+{
+   uint16_t step = (pulse_counts_left > 0x8000) ? 0x8000 : pulse_counts_left;
    
-   uart0_xmit(app_regs.REG_COLOR_ARRAY, cmd_array[3] * 3);
-   uart1_xmit(app_regs.REG_COLOR_ARRAY + 96, cmd_array[3] * 3);
+   pulse_counts_left -= step;
+   TCE0.CCB = from + step;
 }
 
-void start_demo_mode (void)
+/* From the last compare, so the errors don't add up */
+static void wait_pulse_time (uint16_t from, uint32_t us)
+{
+   pulse_counts_left = us * TCE0_COUNTS_PER_US;
+   advance_pulse_compare(from);
+}
+
+static void set_leds_status (uint8_t status)
 {
-   uint8_t leds_on_bus = app_regs.REG_LEDS_ON_BUS;
+   app_write_REG_LEDS_STATUS(&status);
+}
+
+void start_pulse_train (void)
+{
+   set_tce0_int_level(TC0_CCBINTLVL_gm, 0);
    
-   set_DEMO_MODE0;
-   set_DEMO_MODE1;
+   if (app_regs.REG_PULSE_COUNT == 0)
+      return;
    
-   uart0_xmit(cmd_demo, 3);
-   uart1_xmit(cmd_demo, 3);
+   pulse_is_on = true;
+   set_leds_status(B_RGB_ON);
    
-   uart0_xmit(&leds_on_bus, 1);
-   uart1_xmit(&leds_on_bus, 1);
+   wait_pulse_time(TCE0.CNT, app_regs.REG_PULSE_ON_TIME);
+   TCE0.INTFLAGS = TC0_CCBIF_bm;
+   set_tce0_int_level(TC0_CCBINTLVL_gm, TC_CCBINTLVL_HI_gc);
 }
 
-void define_off_values (uint8_t red, uint8_t green, uint8_t blue)
+/*
+* Called by the compare channel B, on the high level. The edges are the same ones
+* of REG_LEDS_STATUS, which is updated later.
+*/
+void pulse_train_compare (void)
 {
-   clr_DEMO_MODE0;   // Stop demonstration mode if active
-   clr_DEMO_MODE1;
-   
-   cmd_off[3] = app_regs.REG_LEDS_ON_BUS;   
-   uint8_t rgb[3] = {red, green, blue};
+   if (pulse_counts_left)
+   {
+      advance_pulse_compare(TCE0.CCB);
+      return;
+   }
    
-   uart0_xmit(cmd_off, 4);   
-   uart1_xmit(cmd_off, 4);
+   stop_demo_mode();
    
-   uart0_xmit(rgb, 3);
-   uart1_xmit(rgb, 3);
+   if (pulse_is_on)
+   {
+      pulse_is_on = false;
+      set_DISABLE_LEDS0;
+      set_DISABLE_LEDS1;
+      clr_DISABLE_LEDS0;
+      clr_DISABLE_LEDS1;
+      do_later(LATER_PULSE_OFF);
+      
+      if (app_regs.REG_PULSE_COUNT)
+         app_regs.REG_PULSE_COUNT--;
+      
+      if (app_regs.REG_PULSE_COUNT == 0)
+      {
+         TCE0.INTCTRLB &= ~TC0_CCBINTLVL_gm;
+         return;
+      }
+      
+      wait_pulse_time(TCE0.CCB, app_regs.REG_PULSE_OFF_TIME);
+   }
+   else
+   {
+      pulse_is_on = true;
+      set_UPDATE_LEDS0;
+      set_UPDATE_LEDS1;
+      clr_UPDATE_LEDS0;
+      clr_UPDATE_LEDS1;
+      do_later(LATER_PULSE_ON);
+      
+      wait_pulse_time(TCE0.CCB, app_regs.REG_PULSE_ON_TIME);
+   }
 }
 
-void stop_demo_mode (void)
+/* Called by the compare channel C, on the low level */
+void tce0_edges_were_made (void)
 {
-   clr_DEMO_MODE0;
-   clr_DEMO_MODE1;
+   uint8_t sreg = SREG;
+   cli();
+   uint8_t work = tce0_later;
+   tce0_later = 0;
+   TCE0.INTCTRLB &= ~TC0_CCCINTLVL_gm;
+   SREG = sreg;
+   
+   if (work & LATER_PRESENTATION)
+      presentation_was_shown();
+   
+   if (work & LATER_PULSE_ON)
+      mark_display_time();
+   
+   if (work & (LATER_PULSE_ON | LATER_PULSE_OFF))
+      app_regs.REG_LEDS_STATUS = pulse_is_on ? B_RGB_ON : B_RGB_OFF;
 }
 
 
@@ -149,6 +1823,14 @@ void core_callback_initialize_hardware(void)
    uart1_init(0, 1, false);   // 1 Mb/s
    uart0_enable();
    uart1_enable();
+   
+   /* Free running timer for the scheduled frames and the pulse train */
+   TCE0.PER = 0xFFFF;
+   TCE0.CTRLA = TC_CLKSEL_DIV8_gc;
+   
+   /* Free running timer for the pulses of the digital outputs */
+   TCC0.PER = 0xFFFF;
+   TCC0.CTRLA = TC_CLKSEL_DIV256_gc;
 }
 
 void core_callback_reset_registers(void)
@@ -176,8 +1858,60 @@ void core_callback_reset_registers(void)
    
    app_regs.REG_PULSE_PERIOD = 100;
    app_regs.REG_PULSE_COUNT = 0;
+   app_regs.REG_PULSE_ON_TIME = 50000;
+   app_regs.REG_PULSE_OFF_TIME = 50000;
    
    app_regs.REG_EVNT_ENABLE = B_EVT_LED_STATUS | B_EVT_INPUTS_STATE;
+   
+   for (uint8_t i = 0; i < 8; i++)
+      app_regs.REG_STRIP_LEDS[i] = 0;
+   
+   app_regs.REG_SEQUENCE_CONTROL = 0;
+   
+   app_regs.REG_BRIGHTNESS = 255;
+   app_regs.REG_GAMMA = 0;
+   
+   for (uint8_t i = 0; i < 6; i++)
+      app_regs.REG_EFFECT[i] = 0;
+   
+   app_regs.REG_FADE_DURATION = 0;
+   
+   app_regs.REG_EXTENDED_LEDS = 0;
+   
+   app_regs.REG_COALESCED_FRAMES = 0;
+   
+   app_regs.REG_INDEPENDENT_BUSES = 0;
+   
+   app_regs.REG_PRESENTATION_TIME[0] = 0;
+   app_regs.REG_PRESENTATION_TIME[1] = 0;
+   
+   app_regs.REG_FRAME_RING_COUNT = 0;
+   app_regs.REG_FRAME_RING_HEAD = 0;
+   app_regs.REG_FRAME_RING_TAIL = 0;
+   
+   app_regs.REG_DISPLAY_TIME = 0;
+   
+   clear_latencies();
+   
+   for (uint8_t i = 0; i < 3; i++)
+      app_regs.REG_FRAME_COUNTERS[i] = 0;
+   
+   app_regs.REG_LOAD_TIMEOUTS = 0;
+   clear_latch_skew();
+   
+   app_regs.REG_LINK_SPEED = GM_LINK_4MBPS;
+   
+   app_regs.REG_FRAME_CRC[0] = 0;
+   app_regs.REG_FRAME_CRC[1] = 0;
+   
+   clear_link_errors();
+   app_regs.REG_LINK_RESYNCS[0] = 0;
+   app_regs.REG_LINK_RESYNCS[1] = 0;
+   
+   clear_update_latency();
+   
+   for (uint16_t i = 0; i < PALETTE_ENTRIES * 3; i++)
+      app_regs.REG_PALETTE[i] = 0;
 }
 
 void core_callback_registers_were_reinitialized(void)
@@ -187,7 +1921,17 @@ void core_callback_registers_were_reinitialized(void)
    app_regs.REG_LEDS_STATUS = B_RGB_OFF;
    
    _delay_ms(200);
+   shadow_valid = 0;
+   clear_scheduled_frames();
+   clear_frame_ring();
+   define_strips();
+   control_sequence(B_SEQ_CLEAR | B_SEQ_STOP);
+   define_brightness();
+   define_gamma();
+   define_fade_duration();
    define_off_values(app_regs.REG_COLOR_OFF[0], app_regs.REG_COLOR_OFF[1], app_regs.REG_COLOR_OFF[2]);
+   define_palette();
+   start_link();
    timer_type1_enable(&TCD1, TIMER_PRESCALER_DIV256, 3125, INT_LEVEL_LOW);  // 25 ms
    
    app_write_REG_OUTPUTS_OUT(&app_regs.REG_OUTPUTS_OUT);
@@ -219,52 +1963,12 @@ void core_callback_t_after_exec(void) {}
 void core_callback_t_new_second(void) {}
 void core_callback_t_500us(void) {}
 
-extern bool start_array_pulses;
-
-uint16_t pulse_counter = 0;
-bool last_array_state = false;
-
 void core_callback_t_1ms(void)
 {
-   if (start_array_pulses)
-   {
-      start_array_pulses = false;
-      
-      pulse_counter = 0;
-      last_array_state = true;
-      
-      uint8_t aux = B_RGB_ON;
-      app_write_REG_LEDS_STATUS(&aux);
-   }
-   else
-   {
-      if (app_regs.REG_PULSE_COUNT > 0)
-      {
-         pulse_counter++;
-         
-         if (pulse_counter == (app_regs.REG_PULSE_PERIOD/2))
-         {
-            pulse_counter = 0;
-            
-            if (last_array_state == false)
-            {
-               last_array_state = true;
-               
-               uint8_t aux = B_RGB_ON;
-               app_write_REG_LEDS_STATUS(&aux);
-            }
-            else
-            {
-               last_array_state = false;
-               
-               uint8_t aux = B_RGB_OFF;
-               app_write_REG_LEDS_STATUS(&aux);
-               
-               app_regs.REG_PULSE_COUNT--;
-            }
-         }
-      }
-   }      
+   check_presentation_time();
+   check_link();
+   check_load_timeout();
+   retry_frame_loads();
 }
 
 /************************************************************************/
@@ -4,12 +4,40 @@
 
 #include <string.h>  // For the memcpy()
 
-void update_bus (void);
+void update_bus (uint8_t buses);
 void start_demo_mode (void);
 void stop_demo_mode (void);
 void define_off_values (uint8_t red, uint8_t green, uint8_t blue);
+void define_strips (void);
+void update_bus_window (uint8_t bus, uint8_t first_led, uint8_t leds);
+void update_bus_scatter (uint8_t * list_bus0, uint8_t leds_bus0, uint8_t * list_bus1, uint8_t leds_bus1);
+void append_sequence_frame (uint8_t * rgb);
+void control_sequence (uint8_t command);
+void define_brightness (void);
+void define_gamma (void);
+void start_effect (void);
+void define_fade_duration (void);
+void update_bus_page (uint8_t bus, uint16_t first_led, uint8_t leds, uint8_t * rgb, bool commit);
+bool schedule_frame (uint32_t seconds, uint32_t useconds, uint8_t * rgb);
+bool append_ring_frame (uint8_t * rgb);
+void clear_frame_ring (void);
+void start_frame_ring (void);
+void start_pulse_train (void);
+void route_di0_to_updates (bool enable);
+void mark_display_time (void);
+void clear_latencies (void);
+void clear_latch_skew (void);
+void start_link (void);
+void clear_link_errors (void);
+void clear_update_latency (void);
+void define_palette (void);
+void update_bus_indexed (uint8_t * indexes);
+void append_sequence_palette_frame (uint8_t * indexes);
+uint8_t link_status (uint8_t bus);
+
+extern uint8_t sequence_frames[2];
+extern uint8_t shadow_valid;
 
-bool start_array_pulses = false;
 
 /************************************************************************/
 /* Create pointers to functions                                         */
@@ -36,7 +64,44 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_OUTPUTS_OUT,
 	&app_read_REG_PULSE_PERIOD,
 	&app_read_REG_PULSE_COUNT,
-	&app_read_REG_EVNT_ENABLE
+	&app_read_REG_EVNT_ENABLE,
+	&app_read_REG_STRIP_LEDS,
+	&app_read_REG_RGB_WINDOW,
+	&app_read_REG_RGB_SCATTER,
+	&app_read_REG_SEQUENCE_FRAME,
+	&app_read_REG_SEQUENCE_CONTROL,
+	&app_read_REG_SEQUENCE_LENGTH,
+	&app_read_REG_BRIGHTNESS,
+	&app_read_REG_GAMMA,
+	&app_read_REG_EFFECT,
+	&app_read_REG_FADE_DURATION,
+	&app_read_REG_EXTENDED_LEDS,
+	&app_read_REG_RGB_PAGE,
+	&app_read_REG_COALESCED_FRAMES,
+	&app_read_REG_INDEPENDENT_BUSES,
+	&app_read_REG_PRESENTATION_TIME,
+	&app_read_REG_SCHEDULED_FRAME,
+	&app_read_REG_FRAME_RING,
+	&app_read_REG_FRAME_RING_COUNT,
+	&app_read_REG_FRAME_RING_HEAD,
+	&app_read_REG_FRAME_RING_TAIL,
+	&app_read_REG_PULSE_ON_TIME,
+	&app_read_REG_PULSE_OFF_TIME,
+	&app_read_REG_DISPLAY_TIME,
+	&app_read_REG_LATENCY_STATS,
+	&app_read_REG_LATENCY_HISTOGRAM,
+	&app_read_REG_FRAME_COUNTERS,
+	&app_read_REG_LOAD_TIMEOUTS,
+	&app_read_REG_LATCH_SKEW,
+	&app_read_REG_LINK_SPEED,
+	&app_read_REG_LINK_STATUS,
+	&app_read_REG_PALETTE,
+	&app_read_REG_PALETTE_FRAME,
+	&app_read_REG_SEQUENCE_PALETTE_FRAME,
+	&app_read_REG_FRAME_CRC,
+	&app_read_REG_LINK_ERRORS,
+	&app_read_REG_LINK_RESYNCS,
+	&app_read_REG_UPDATE_LATENCY
 };
 
 bool (*app_func_wr_pointer[])(void*) = {
@@ -59,7 +124,44 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_OUTPUTS_OUT,
 	&app_write_REG_PULSE_PERIOD,
 	&app_write_REG_PULSE_COUNT,
-	&app_write_REG_EVNT_ENABLE
+	&app_write_REG_EVNT_ENABLE,
+	&app_write_REG_STRIP_LEDS,
+	&app_write_REG_RGB_WINDOW,
+	&app_write_REG_RGB_SCATTER,
+	&app_write_REG_SEQUENCE_FRAME,
+	&app_write_REG_SEQUENCE_CONTROL,
+	&app_write_REG_SEQUENCE_LENGTH,
+	&app_write_REG_BRIGHTNESS,
+	&app_write_REG_GAMMA,
+	&app_write_REG_EFFECT,
+	&app_write_REG_FADE_DURATION,
+	&app_write_REG_EXTENDED_LEDS,
+	&app_write_REG_RGB_PAGE,
+	&app_write_REG_COALESCED_FRAMES,
+	&app_write_REG_INDEPENDENT_BUSES,
+	&app_write_REG_PRESENTATION_TIME,
+	&app_write_REG_SCHEDULED_FRAME,
+	&app_write_REG_FRAME_RING,
+	&app_write_REG_FRAME_RING_COUNT,
+	&app_write_REG_FRAME_RING_HEAD,
+	&app_write_REG_FRAME_RING_TAIL,
+	&app_write_REG_PULSE_ON_TIME,
+	&app_write_REG_PULSE_OFF_TIME,
+	&app_write_REG_DISPLAY_TIME,
+	&app_write_REG_LATENCY_STATS,
+	&app_write_REG_LATENCY_HISTOGRAM,
+	&app_write_REG_FRAME_COUNTERS,
+	&app_write_REG_LOAD_TIMEOUTS,
+	&app_write_REG_LATCH_SKEW,
+	&app_write_REG_LINK_SPEED,
+	&app_write_REG_LINK_STATUS,
+	&app_write_REG_PALETTE,
+	&app_write_REG_PALETTE_FRAME,
+	&app_write_REG_SEQUENCE_PALETTE_FRAME,
+	&app_write_REG_FRAME_CRC,
+	&app_write_REG_LINK_ERRORS,
+	&app_write_REG_LINK_RESYNCS,
+	&app_write_REG_UPDATE_LATENCY
 };
 
 
@@ -81,6 +183,7 @@ bool app_write_REG_LEDS_STATUS(void *a)
       set_UPDATE_LEDS1;
       clr_UPDATE_LEDS0;
       clr_UPDATE_LEDS1;
+      mark_display_time();
    }
       
    if (reg & B_RGB_OFF)
@@ -119,6 +222,10 @@ bool app_write_REG_LEDS_ON_BUS(void *a)
       return false;
 
 	app_regs.REG_LEDS_ON_BUS = reg;
+   
+   /* The next frames are sent whole with the new length */
+   shadow_valid = 0;
+   
 	return true;
 }
 
@@ -134,7 +241,7 @@ bool app_write_REG_COLOR_ARRAY(void *a)
 	uint8_t *reg = ((uint8_t*)a);
    
    memcpy(app_regs.REG_COLOR_ARRAY, reg, 192);
-   update_bus();
+   update_bus(B_BUS0 | B_BUS1);
    
 	return true;
 }
@@ -153,7 +260,7 @@ bool app_write_REG_COLOR_ARRAY_BUS0(void *a)
 	uint8_t *reg = ((uint8_t*)a);
 
    memcpy(app_regs.REG_COLOR_ARRAY, reg, 96);
-   update_bus();
+   update_bus(B_BUS0);
    
 	return true;
 }
@@ -172,7 +279,7 @@ bool app_write_REG_COLOR_ARRAY_BUS1(void *a)
 	uint8_t *reg = ((uint8_t*)a);
 
 	memcpy(app_regs.REG_COLOR_ARRAY+96, reg, 96);
-	update_bus();
+	update_bus(B_BUS1);
    
 	return true;
 }
@@ -229,7 +336,7 @@ bool app_write_REG_DI0_CONF(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
    
-   if (reg & ~MSK_DI0_SEL)
+   if ((reg & ~MSK_DI0_SEL) || reg > GM_DI0_RISE_UPDATE_EVENTS)
       return false;
    
    if (reg == GM_DI0_HIGH_RGBS_ON)
@@ -249,10 +356,18 @@ bool app_write_REG_DI0_CONF(void *a)
          set_UPDATE_LEDS1;
          clr_UPDATE_LEDS0;
          clr_UPDATE_LEDS1;
+         mark_display_time();
       }
    }
 
 	app_regs.REG_DI0_CONF = reg;
+   
+   route_di0_to_updates(reg == GM_DI0_RISE_UPDATE_EVENTS);
+   
+   /* The first frame of the ring waits for the first step */
+   if (reg == GM_DI0_STEP_FRAMES)
+      start_frame_ring();
+   
 	return true;
 }
 
@@ -422,10 +537,15 @@ bool app_write_REG_OUTPUTS_OUT(void *a)
 void app_read_REG_PULSE_PERIOD(void) {}
 bool app_write_REG_PULSE_PERIOD(void *a)
 {   
-   if (*((uint16_t*)a) < 20)
+   if (*((uint16_t*)a) < 1)
       return false;
    
 	app_regs.REG_PULSE_PERIOD = *((uint16_t*)a);
+   
+   /* Half of the period on and half off */
+   app_regs.REG_PULSE_ON_TIME = app_regs.REG_PULSE_PERIOD * 500UL;
+   app_regs.REG_PULSE_OFF_TIME = app_regs.REG_PULSE_PERIOD * 500UL;
+   
 	return true;
 }
 
@@ -436,9 +556,9 @@ bool app_write_REG_PULSE_PERIOD(void *a)
 void app_read_REG_PULSE_COUNT(void) {}
 bool app_write_REG_PULSE_COUNT(void *a)
 {
-   start_array_pulses = true;
-
 	app_regs.REG_PULSE_COUNT = *((uint8_t*)a);
+   start_pulse_train();
+   
 	return true;
 }
 
@@ -451,9 +571,587 @@ bool app_write_REG_EVNT_ENABLE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
    
-   if (reg & ~(B_EVT_INPUTS_STATE | B_EVT_LED_STATUS))
+   if (reg & ~(B_EVT_INPUTS_STATE | B_EVT_LED_STATUS | B_EVT_DISPLAY_TIME | B_EVT_FRAME_CRC))
       return false;
 
 	app_regs.REG_EVNT_ENABLE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STRIP_LEDS                                                       */
+/************************************************************************/
+// This register is an array with 8 positions
+void app_read_REG_STRIP_LEDS(void) {}
+bool app_write_REG_STRIP_LEDS(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+   
+   for (uint8_t i = 0; i < 8; i++)
+      if (reg[i] > 31)
+         return false;
+
+	memcpy(app_regs.REG_STRIP_LEDS, reg, 8);
+   define_strips();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_RGB_WINDOW                                                       */
+/************************************************************************/
+// This register is an array with 99 positions
+// Write only, the colors are merged into REG_COLOR_ARRAY
+void app_read_REG_RGB_WINDOW(void) {}
+bool app_write_REG_RGB_WINDOW(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+   
+   uint8_t bus = reg[0];
+   uint8_t first_led = reg[1];
+   uint8_t leds = reg[2];
+   
+   if (bus > 1 || leds < 1 || leds > 32 || first_led + leds > 32)
+      return false;
+   
+   memcpy(app_regs.REG_COLOR_ARRAY + bus*96 + first_led*3, reg + 3, leds*3);
+   update_bus_window(bus, first_led, leds);
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_RGB_SCATTER                                                      */
+/************************************************************************/
+// This register is an array with 64 positions
+// Write only, the colors are merged into REG_COLOR_ARRAY
+void app_read_REG_RGB_SCATTER(void) {}
+bool app_write_REG_RGB_SCATTER(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+   
+   uint8_t list[2][64];
+   uint8_t leds[2] = {0, 0};
+   
+   for (uint8_t i = 0; i < 64 && reg[i] != SCATTER_END; i += 4)
+   {
+      if ((reg[i] & MSK_SCATTER_INDEX) >= 32)
+         return false;
+   }
+   
+   for (uint8_t i = 0; i < 64 && reg[i] != SCATTER_END; i += 4)
+   {
+      uint8_t bus = (reg[i] & B_SCATTER_BUS1) ? 1 : 0;
+      uint8_t index = reg[i] & MSK_SCATTER_INDEX;
+      
+      memcpy(app_regs.REG_COLOR_ARRAY + bus*96 + index*3, reg + i + 1, 3);
+      
+      list[bus][leds[bus]*4 + 0] = index;
+      memcpy(&list[bus][leds[bus]*4 + 1], reg + i + 1, 3);
+      leds[bus]++;
+   }
+   
+   if (leds[0] == 0 && leds[1] == 0)
+      return false;
+   
+   update_bus_scatter(list[0], leds[0], list[1], leds[1]);
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_FRAME                                                   */
+/************************************************************************/
+// This register is an array with 192 positions
+// Write only, the frame is sent straight to the buses
+void app_read_REG_SEQUENCE_FRAME(void) {}
+bool app_write_REG_SEQUENCE_FRAME(void *a)
+{
+   append_sequence_frame((uint8_t*)a);
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_CONTROL                                                 */
+/************************************************************************/
+void app_read_REG_SEQUENCE_CONTROL(void) {}
+bool app_write_REG_SEQUENCE_CONTROL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg & ~(B_SEQ_CLEAR | B_SEQ_REWIND | B_SEQ_PLAY | B_SEQ_STOP))
+      return false;
+   
+   if ((reg & B_SEQ_PLAY) && (reg & B_SEQ_STOP))
+      return false;
+   
+   control_sequence(reg);
+
+	app_regs.REG_SEQUENCE_CONTROL = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_LENGTH                                                  */
+/************************************************************************/
+void app_read_REG_SEQUENCE_LENGTH(void)
+{
+   /* A frame is only played when both buses have it */
+   if (sequence_frames[0] < sequence_frames[1])
+      app_regs.REG_SEQUENCE_LENGTH = sequence_frames[0];
+   else
+      app_regs.REG_SEQUENCE_LENGTH = sequence_frames[1];
+}
+bool app_write_REG_SEQUENCE_LENGTH(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_BRIGHTNESS                                                       */
+/************************************************************************/
+void app_read_REG_BRIGHTNESS(void) {}
+bool app_write_REG_BRIGHTNESS(void *a)
+{
+	app_regs.REG_BRIGHTNESS = *((uint8_t*)a);
+   define_brightness();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_GAMMA                                                            */
+/************************************************************************/
+void app_read_REG_GAMMA(void) {}
+bool app_write_REG_GAMMA(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > 1)
+      return false;
+
+	app_regs.REG_GAMMA = reg;
+   define_gamma();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EFFECT                                                           */
+/************************************************************************/
+// This register is an array with 6 positions
+void app_read_REG_EFFECT(void) {}
+bool app_write_REG_EFFECT(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+   
+   if (reg[0] > GM_EFFECT_BREATHING)
+      return false;
+
+	memcpy(app_regs.REG_EFFECT, reg, 6);
+   start_effect();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FADE_DURATION                                                    */
+/************************************************************************/
+void app_read_REG_FADE_DURATION(void) {}
+bool app_write_REG_FADE_DURATION(void *a)
+{
+	app_regs.REG_FADE_DURATION = *((uint16_t*)a);
+   define_fade_duration();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EXTENDED_LEDS                                                    */
+/************************************************************************/
+void app_read_REG_EXTENDED_LEDS(void) {}
+bool app_write_REG_EXTENDED_LEDS(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+   
+   if (reg > MAX_EXTENDED_LEDS)
+      return false;
+
+	app_regs.REG_EXTENDED_LEDS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_RGB_PAGE                                                         */
+/************************************************************************/
+// This register is an array with 100 positions
+// Write only, the page is sent straight to the bus
+void app_read_REG_RGB_PAGE(void) {}
+bool app_write_REG_RGB_PAGE(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+   
+   uint8_t flags = reg[0];
+   uint16_t first_led = reg[1] | (reg[2] << 8);
+   uint8_t leds = reg[3];
+   
+   if (app_regs.REG_EXTENDED_LEDS == 0)
+      return false;
+   
+   if (flags & ~(B_PAGE_BUS1 | B_PAGE_COMMIT))
+      return false;
+   
+   if (leds > 32 || first_led + leds > app_regs.REG_EXTENDED_LEDS)
+      return false;
+   
+   update_bus_page((flags & B_PAGE_BUS1) ? 1 : 0, first_led, leds, reg + 4, (flags & B_PAGE_COMMIT) ? true : false);
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_COALESCED_FRAMES                                                 */
+/************************************************************************/
+void app_read_REG_COALESCED_FRAMES(void) {}
+bool app_write_REG_COALESCED_FRAMES(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_INDEPENDENT_BUSES                                                */
+/************************************************************************/
+void app_read_REG_INDEPENDENT_BUSES(void) {}
+bool app_write_REG_INDEPENDENT_BUSES(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > 1)
+      return false;
+
+	app_regs.REG_INDEPENDENT_BUSES = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PRESENTATION_TIME                                                */
+/************************************************************************/
+// This register is an array with 2 positions
+void app_read_REG_PRESENTATION_TIME(void) {}
+bool app_write_REG_PRESENTATION_TIME(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+   
+   if (reg[1] > 999999)
+      return false;
+
+	app_regs.REG_PRESENTATION_TIME[0] = reg[0];
+	app_regs.REG_PRESENTATION_TIME[1] = reg[1];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SCHEDULED_FRAME                                                  */
+/************************************************************************/
+// This register is an array with 192 positions
+// Write only, the frame goes straight to the queue
+void app_read_REG_SCHEDULED_FRAME(void) {}
+bool app_write_REG_SCHEDULED_FRAME(void *a)
+{
+   /* Fails when the queue is full */
+	return schedule_frame(app_regs.REG_PRESENTATION_TIME[0], app_regs.REG_PRESENTATION_TIME[1], (uint8_t*)a);
+}
+
+
+/************************************************************************/
+/* REG_FRAME_RING                                                       */
+/************************************************************************/
+// This register is an array with 192 positions
+// Write only, the frame goes straight to the ring
+void app_read_REG_FRAME_RING(void) {}
+bool app_write_REG_FRAME_RING(void *a)
+{
+   /* Fails when the ring is full */
+	return append_ring_frame((uint8_t*)a);
+}
+
+
+/************************************************************************/
+/* REG_FRAME_RING_COUNT                                                 */
+/************************************************************************/
+void app_read_REG_FRAME_RING_COUNT(void) {}
+bool app_write_REG_FRAME_RING_COUNT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg != 0)
+      return false;
+
+	clear_frame_ring();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FRAME_RING_HEAD                                                  */
+/************************************************************************/
+void app_read_REG_FRAME_RING_HEAD(void) {}
+bool app_write_REG_FRAME_RING_HEAD(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_FRAME_RING_TAIL                                                  */
+/************************************************************************/
+void app_read_REG_FRAME_RING_TAIL(void) {}
+bool app_write_REG_FRAME_RING_TAIL(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_PULSE_ON_TIME                                                    */
+/************************************************************************/
+void app_read_REG_PULSE_ON_TIME(void) {}
+bool app_write_REG_PULSE_ON_TIME(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+   
+   if (reg < MIN_PULSE_TIME_US || reg > MAX_PULSE_TIME_US)
+      return false;
+
+	app_regs.REG_PULSE_ON_TIME = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PULSE_OFF_TIME                                                   */
+/************************************************************************/
+void app_read_REG_PULSE_OFF_TIME(void) {}
+bool app_write_REG_PULSE_OFF_TIME(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+   
+   if (reg < MIN_PULSE_TIME_US || reg > MAX_PULSE_TIME_US)
+      return false;
+
+	app_regs.REG_PULSE_OFF_TIME = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DISPLAY_TIME                                                     */
+/************************************************************************/
+void app_read_REG_DISPLAY_TIME(void) {}
+bool app_write_REG_DISPLAY_TIME(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_LATENCY_STATS                                                    */
+/************************************************************************/
+// This register is an array with 12 positions
+// Any write clears the statistics and the histogram
+void app_read_REG_LATENCY_STATS(void) {}
+bool app_write_REG_LATENCY_STATS(void *a)
+{
+   clear_latencies();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LATENCY_HISTOGRAM                                                */
+/************************************************************************/
+// This register is an array with 16 positions
+// Any write clears the statistics and the histogram
+void app_read_REG_LATENCY_HISTOGRAM(void) {}
+bool app_write_REG_LATENCY_HISTOGRAM(void *a)
+{
+   clear_latencies();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FRAME_COUNTERS                                                   */
+/************************************************************************/
+// This register is an array with 3 positions
+// Any write clears the counters
+void app_read_REG_FRAME_COUNTERS(void) {}
+bool app_write_REG_FRAME_COUNTERS(void *a)
+{
+   for (uint8_t i = 0; i < 3; i++)
+      app_regs.REG_FRAME_COUNTERS[i] = 0;
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOAD_TIMEOUTS                                                    */
+/************************************************************************/
+void app_read_REG_LOAD_TIMEOUTS(void) {}
+bool app_write_REG_LOAD_TIMEOUTS(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_LATCH_SKEW                                                       */
+/************************************************************************/
+// This register is an array with 3 positions
+// Any write clears the skews
+void app_read_REG_LATCH_SKEW(void) {}
+bool app_write_REG_LATCH_SKEW(void *a)
+{
+   clear_latch_skew();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LINK_SPEED                                                       */
+/************************************************************************/
+void app_read_REG_LINK_SPEED(void) {}
+bool app_write_REG_LINK_SPEED(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > GM_LINK_4MBPS)
+      return false;
+   
+	app_regs.REG_LINK_SPEED = reg;
+   start_link();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LINK_STATUS                                                      */
+/************************************************************************/
+// This register is an array with 2 positions
+void app_read_REG_LINK_STATUS(void)
+{
+   app_regs.REG_LINK_STATUS[0] = link_status(0);
+   app_regs.REG_LINK_STATUS[1] = link_status(1);
+}
+bool app_write_REG_LINK_STATUS(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_PALETTE                                                          */
+/************************************************************************/
+// This register is an array with 192 positions
+void app_read_REG_PALETTE(void) {}
+bool app_write_REG_PALETTE(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+
+	memcpy(app_regs.REG_PALETTE, reg, 192);
+   define_palette();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PALETTE_FRAME                                                    */
+/************************************************************************/
+// This register is an array with 64 positions
+// Write only, the indexes are sent straight to the buses
+void app_read_REG_PALETTE_FRAME(void) {}
+bool app_write_REG_PALETTE_FRAME(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+   
+   for (uint8_t i = 0; i < 64; i++)
+      if (reg[i] >= PALETTE_ENTRIES)
+         return false;
+
+   update_bus_indexed(reg);
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_PALETTE_FRAME                                           */
+/************************************************************************/
+// This register is an array with 64 positions
+// Write only, the indexes are sent straight to the buses
+void app_read_REG_SEQUENCE_PALETTE_FRAME(void) {}
+bool app_write_REG_SEQUENCE_PALETTE_FRAME(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+   
+   for (uint8_t i = 0; i < 64; i++)
+      if (reg[i] >= PALETTE_ENTRIES)
+         return false;
+
+   append_sequence_palette_frame(reg);
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FRAME_CRC                                                        */
+/************************************************************************/
+// This register is an array with 2 positions
+void app_read_REG_FRAME_CRC(void) {}
+bool app_write_REG_FRAME_CRC(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_LINK_ERRORS                                                      */
+/************************************************************************/
+// This register is an array with 12 positions
+// Any write clears the counters
+void app_read_REG_LINK_ERRORS(void) {}
+bool app_write_REG_LINK_ERRORS(void *a)
+{
+   clear_link_errors();
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LINK_RESYNCS                                                     */
+/************************************************************************/
+// This register is an array with 2 positions
+// Any write clears the counters
+void app_read_REG_LINK_RESYNCS(void) {}
+bool app_write_REG_LINK_RESYNCS(void *a)
+{
+   app_regs.REG_LINK_RESYNCS[0] = 0;
+   app_regs.REG_LINK_RESYNCS[1] = 0;
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_UPDATE_LATENCY                                                   */
+/************************************************************************/
+// This register is an array with 6 positions
+// Any write clears the measures
+void app_read_REG_UPDATE_LATENCY(void) {}
+bool app_write_REG_UPDATE_LATENCY(void *a)
+{
+   clear_update_latency();
+   
 	return true;
 }
\ No newline at end of file
@@ -40,6 +40,43 @@ void app_read_REG_OUTPUTS_OUT(void);
 void app_read_REG_PULSE_PERIOD(void);
 void app_read_REG_PULSE_COUNT(void);
 void app_read_REG_EVNT_ENABLE(void);
+void app_read_REG_STRIP_LEDS(void);
+void app_read_REG_RGB_WINDOW(void);
+void app_read_REG_RGB_SCATTER(void);
+void app_read_REG_SEQUENCE_FRAME(void);
+void app_read_REG_SEQUENCE_CONTROL(void);
+void app_read_REG_SEQUENCE_LENGTH(void);
+void app_read_REG_BRIGHTNESS(void);
+void app_read_REG_GAMMA(void);
+void app_read_REG_EFFECT(void);
+void app_read_REG_FADE_DURATION(void);
+void app_read_REG_EXTENDED_LEDS(void);
+void app_read_REG_RGB_PAGE(void);
+void app_read_REG_COALESCED_FRAMES(void);
+void app_read_REG_INDEPENDENT_BUSES(void);
+void app_read_REG_PRESENTATION_TIME(void);
+void app_read_REG_SCHEDULED_FRAME(void);
+void app_read_REG_FRAME_RING(void);
+void app_read_REG_FRAME_RING_COUNT(void);
+void app_read_REG_FRAME_RING_HEAD(void);
+void app_read_REG_FRAME_RING_TAIL(void);
+void app_read_REG_PULSE_ON_TIME(void);
+void app_read_REG_PULSE_OFF_TIME(void);
+void app_read_REG_DISPLAY_TIME(void);
+void app_read_REG_LATENCY_STATS(void);
+void app_read_REG_LATENCY_HISTOGRAM(void);
+void app_read_REG_FRAME_COUNTERS(void);
+void app_read_REG_LOAD_TIMEOUTS(void);
+void app_read_REG_LATCH_SKEW(void);
+void app_read_REG_LINK_SPEED(void);
+void app_read_REG_LINK_STATUS(void);
+void app_read_REG_PALETTE(void);
+void app_read_REG_PALETTE_FRAME(void);
+void app_read_REG_SEQUENCE_PALETTE_FRAME(void);
+void app_read_REG_FRAME_CRC(void);
+void app_read_REG_LINK_ERRORS(void);
+void app_read_REG_LINK_RESYNCS(void);
+void app_read_REG_UPDATE_LATENCY(void);
 
 bool app_write_REG_LEDS_STATUS(void *a);
 bool app_write_REG_LEDS_ON_BUS(void *a);
@@ -61,6 +98,43 @@ bool app_write_REG_OUTPUTS_OUT(void *a);
 bool app_write_REG_PULSE_PERIOD(void *a);
 bool app_write_REG_PULSE_COUNT(void *a);
 bool app_write_REG_EVNT_ENABLE(void *a);
+bool app_write_REG_STRIP_LEDS(void *a);
+bool app_write_REG_RGB_WINDOW(void *a);
+bool app_write_REG_RGB_SCATTER(void *a);
+bool app_write_REG_SEQUENCE_FRAME(void *a);
+bool app_write_REG_SEQUENCE_CONTROL(void *a);
+bool app_write_REG_SEQUENCE_LENGTH(void *a);
+bool app_write_REG_BRIGHTNESS(void *a);
+bool app_write_REG_GAMMA(void *a);
+bool app_write_REG_EFFECT(void *a);
+bool app_write_REG_FADE_DURATION(void *a);
+bool app_write_REG_EXTENDED_LEDS(void *a);
+bool app_write_REG_RGB_PAGE(void *a);
+bool app_write_REG_COALESCED_FRAMES(void *a);
+bool app_write_REG_INDEPENDENT_BUSES(void *a);
+bool app_write_REG_PRESENTATION_TIME(void *a);
+bool app_write_REG_SCHEDULED_FRAME(void *a);
+bool app_write_REG_FRAME_RING(void *a);
+bool app_write_REG_FRAME_RING_COUNT(void *a);
+bool app_write_REG_FRAME_RING_HEAD(void *a);
+bool app_write_REG_FRAME_RING_TAIL(void *a);
+bool app_write_REG_PULSE_ON_TIME(void *a);
+bool app_write_REG_PULSE_OFF_TIME(void *a);
+bool app_write_REG_DISPLAY_TIME(void *a);
+bool app_write_REG_LATENCY_STATS(void *a);
+bool app_write_REG_LATENCY_HISTOGRAM(void *a);
+bool app_write_REG_FRAME_COUNTERS(void *a);
+bool app_write_REG_LOAD_TIMEOUTS(void *a);
+bool app_write_REG_LATCH_SKEW(void *a);
+bool app_write_REG_LINK_SPEED(void *a);
+bool app_write_REG_LINK_STATUS(void *a);
+bool app_write_REG_PALETTE(void *a);
+bool app_write_REG_PALETTE_FRAME(void *a);
+bool app_write_REG_SEQUENCE_PALETTE_FRAME(void *a);
+bool app_write_REG_FRAME_CRC(void *a);
+bool app_write_REG_LINK_ERRORS(void *a);
+bool app_write_REG_LINK_RESYNCS(void *a);
+bool app_write_REG_UPDATE_LATENCY(void *a);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
@@ -72,7 +72,44 @@ uint8_t app_regs_type[] = {
 	TYPE_U8,
 	TYPE_U16,
 	TYPE_U8,
-	TYPE_U8
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_I16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U16
 };
 
 uint16_t app_regs_n_elements[] = {
@@ -95,7 +132,44 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
-	1
+	1,
+	8,
+	99,
+	64,
+	192,
+	1,
+	1,
+	1,
+	1,
+	6,
+	1,
+	1,
+	100,
+	1,
+	1,
+	2,
+	192,
+	192,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	12,
+	16,
+	3,
+	1,
+	3,
+	1,
+	2,
+	192,
+	64,
+	64,
+	2,
+	12,
+	2,
+	6
 };
 
 uint8_t *app_regs_pointer[] = {
@@ -118,5 +192,42 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_OUTPUTS_OUT),
 	(uint8_t*)(&app_regs.REG_PULSE_PERIOD),
 	(uint8_t*)(&app_regs.REG_PULSE_COUNT),
-	(uint8_t*)(&app_regs.REG_EVNT_ENABLE)
+	(uint8_t*)(&app_regs.REG_EVNT_ENABLE),
+	(uint8_t*)(app_regs.REG_STRIP_LEDS),
+	(uint8_t*)(app_regs.REG_COLOR_ARRAY),        // REG_RGB_WINDOW is write only and keeps no copy
+	(uint8_t*)(app_regs.REG_COLOR_ARRAY),        // REG_RGB_SCATTER is write only and keeps no copy
+	(uint8_t*)(app_regs.REG_COLOR_ARRAY),        // REG_SEQUENCE_FRAME is write only and keeps no copy
+	(uint8_t*)(&app_regs.REG_SEQUENCE_CONTROL),
+	(uint8_t*)(&app_regs.REG_SEQUENCE_LENGTH),
+	(uint8_t*)(&app_regs.REG_BRIGHTNESS),
+	(uint8_t*)(&app_regs.REG_GAMMA),
+	(uint8_t*)(app_regs.REG_EFFECT),
+	(uint8_t*)(&app_regs.REG_FADE_DURATION),
+	(uint8_t*)(&app_regs.REG_EXTENDED_LEDS),
+	(uint8_t*)(app_regs.REG_COLOR_ARRAY),        // REG_RGB_PAGE is write only and keeps no copy
+	(uint8_t*)(&app_regs.REG_COALESCED_FRAMES),
+	(uint8_t*)(&app_regs.REG_INDEPENDENT_BUSES),
+	(uint8_t*)(app_regs.REG_PRESENTATION_TIME),
+	(uint8_t*)(app_regs.REG_COLOR_ARRAY),        // REG_SCHEDULED_FRAME is write only and keeps no copy
+	(uint8_t*)(app_regs.REG_COLOR_ARRAY),        // REG_FRAME_RING is write only and keeps no copy
+	(uint8_t*)(&app_regs.REG_FRAME_RING_COUNT),
+	(uint8_t*)(&app_regs.REG_FRAME_RING_HEAD),
+	(uint8_t*)(&app_regs.REG_FRAME_RING_TAIL),
+	(uint8_t*)(&app_regs.REG_PULSE_ON_TIME),
+	(uint8_t*)(&app_regs.REG_PULSE_OFF_TIME),
+	(uint8_t*)(&app_regs.REG_DISPLAY_TIME),
+	(uint8_t*)(app_regs.REG_LATENCY_STATS),
+	(uint8_t*)(app_regs.REG_LATENCY_HISTOGRAM),
+	(uint8_t*)(app_regs.REG_FRAME_COUNTERS),
+	(uint8_t*)(&app_regs.REG_LOAD_TIMEOUTS),
+	(uint8_t*)(app_regs.REG_LATCH_SKEW),
+	(uint8_t*)(&app_regs.REG_LINK_SPEED),
+	(uint8_t*)(app_regs.REG_LINK_STATUS),
+	(uint8_t*)(app_regs.REG_PALETTE),
+	(uint8_t*)(app_regs.REG_COLOR_ARRAY),        // REG_PALETTE_FRAME is write only and keeps no copy
+	(uint8_t*)(app_regs.REG_COLOR_ARRAY),        // REG_SEQUENCE_PALETTE_FRAME is write only and keeps no copy
+	(uint8_t*)(app_regs.REG_FRAME_CRC),
+	(uint8_t*)(app_regs.REG_LINK_ERRORS),
+	(uint8_t*)(app_regs.REG_LINK_RESYNCS),
+	(uint8_t*)(app_regs.REG_UPDATE_LATENCY)
 };
\ No newline at end of file
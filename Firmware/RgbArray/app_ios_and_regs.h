@@ -139,6 +139,35 @@ typedef struct
 	uint16_t REG_PULSE_PERIOD;
 	uint8_t REG_PULSE_COUNT;
 	uint8_t REG_EVNT_ENABLE;
+	uint8_t REG_STRIP_LEDS[8];
+	uint8_t REG_SEQUENCE_CONTROL;
+	uint8_t REG_SEQUENCE_LENGTH;
+	uint8_t REG_BRIGHTNESS;
+	uint8_t REG_GAMMA;
+	uint8_t REG_EFFECT[6];
+	uint16_t REG_FADE_DURATION;
+	uint16_t REG_EXTENDED_LEDS;
+	uint32_t REG_COALESCED_FRAMES;
+	uint8_t REG_INDEPENDENT_BUSES;
+	uint32_t REG_PRESENTATION_TIME[2];
+	uint8_t REG_FRAME_RING_COUNT;
+	uint8_t REG_FRAME_RING_HEAD;
+	uint8_t REG_FRAME_RING_TAIL;
+	uint32_t REG_PULSE_ON_TIME;
+	uint32_t REG_PULSE_OFF_TIME;
+	uint16_t REG_DISPLAY_TIME;
+	uint32_t REG_LATENCY_STATS[12];
+	uint16_t REG_LATENCY_HISTOGRAM[16];
+	uint32_t REG_FRAME_COUNTERS[3];
+	uint32_t REG_LOAD_TIMEOUTS;
+	int16_t REG_LATCH_SKEW[3];
+	uint8_t REG_LINK_SPEED;
+	uint8_t REG_LINK_STATUS[2];
+	uint8_t REG_PALETTE[192];
+	uint16_t REG_FRAME_CRC[2];
+	uint32_t REG_LINK_ERRORS[12];
+	uint32_t REG_LINK_RESYNCS[2];
+	uint16_t REG_UPDATE_LATENCY[6];
 } AppRegs;
 
 /************************************************************************/
@@ -165,6 +194,43 @@ typedef struct
 #define ADD_REG_PULSE_PERIOD                49 // U16    Period of pulses (ms)
 #define ADD_REG_PULSE_COUNT                 50 // U8     Number of pulses to be performed -- write different than 0 to start
 #define ADD_REG_EVNT_ENABLE                 51 // U8     Enable the Events
+#define ADD_REG_STRIP_LEDS                  52 // U8     Number of LEDs on each parallel strip of the buses (Max. is 31)
+#define ADD_REG_RGB_WINDOW                  53 // U8     Update a range of LEDs of one bus [bus first_led num_of_leds R G B ...]
+#define ADD_REG_RGB_SCATTER                 54 // U8     Update a list of up to 16 LEDs [index R G B ...]
+#define ADD_REG_SEQUENCE_FRAME              55 // U8     Append a frame to the sequence stored on the buses
+#define ADD_REG_SEQUENCE_CONTROL            56 // U8     Clear, rewind, play or stop the stored sequence
+#define ADD_REG_SEQUENCE_LENGTH             57 // U8     Number of frames stored on both buses
+#define ADD_REG_BRIGHTNESS                  58 // U8     Brightness applied to all LEDs (255 is the full scale)
+#define ADD_REG_GAMMA                       59 // U8     Enable the gamma correction of the colors
+#define ADD_REG_EFFECT                      60 // U8     Run an effect on the buses [effect speed span R G B]
+#define ADD_REG_FADE_DURATION               61 // U16    Duration of the crossfade when the LEDs are turned on or off (ms)
+#define ADD_REG_EXTENDED_LEDS               62 // U16    Number of LEDs on each bus for the paged frames (Max. is 400)
+#define ADD_REG_RGB_PAGE                    63 // U8     Load a page of a long frame [flags first_led_l first_led_h num_of_leds R G B ...]
+#define ADD_REG_COALESCED_FRAMES            64 // U32    Number of frames replaced or discarded before being sent
+#define ADD_REG_INDEPENDENT_BUSES           65 // U8     Update each bus when its own frame is loaded, instead of both together
+#define ADD_REG_PRESENTATION_TIME           66 // U32    Time to show the next scheduled frame [seconds microseconds]
+#define ADD_REG_SCHEDULED_FRAME             67 // U8     Frame shown at REG_PRESENTATION_TIME [R0 G0 B0 ...]
+#define ADD_REG_FRAME_RING                  68 // U8     Append a frame to the ring stepped by DI0 [R0 G0 B0 ...]
+#define ADD_REG_FRAME_RING_COUNT            69 // U8     Number of frames on the ring, write 0 to clear it
+#define ADD_REG_FRAME_RING_HEAD             70 // U8     Index of the frame shown on the next DI0 step
+#define ADD_REG_FRAME_RING_TAIL             71 // U8     Index where the next frame is appended
+#define ADD_REG_PULSE_ON_TIME               72 // U32    Time the LEDs are on on each pulse (us)
+#define ADD_REG_PULSE_OFF_TIME              73 // U32    Time the LEDs are off after each pulse (us)
+#define ADD_REG_DISPLAY_TIME                74 // U16    Microseconds from the update to the LEDs showing the frame
+#define ADD_REG_LATENCY_STATS               75 // U32    Min, max and mean us of the load, wait, show and total stages
+#define ADD_REG_LATENCY_HISTOGRAM           76 // U16    Frames by total latency, 1 ms buckets
+#define ADD_REG_FRAME_COUNTERS              77 // U32    Frames received, displayed and dropped
+#define ADD_REG_LOAD_TIMEOUTS               78 // U32    Updates done without the load of one of the buses
+#define ADD_REG_LATCH_SKEW                  79 // I16    Last, min and max us from the update of bus 0 to bus 1
+#define ADD_REG_LINK_SPEED                  80 // U8     Fastest speed of the links to the slaves
+#define ADD_REG_LINK_STATUS                 81 // U8     Speed and framing of the link of each bus
+#define ADD_REG_PALETTE                     82 // U8     Colors of the palette, [R][G][B] of each of the 64 entries
+#define ADD_REG_PALETTE_FRAME               83 // U8     Palette index of each LED, bus 0 and then bus 1
+#define ADD_REG_SEQUENCE_PALETTE_FRAME      84 // U8     Indexed frame appended to the stored sequence
+#define ADD_REG_FRAME_CRC                   85 // U16    CRC-16 of the bytes sent to the LEDs on the last update of each bus
+#define ADD_REG_LINK_ERRORS                 86 // U32    Errors of the links, 6 counters for each bus
+#define ADD_REG_LINK_RESYNCS                87 // U32    Times each link was negotiated again after repeated errors
+#define ADD_REG_UPDATE_LATENCY              88 // U16    Last, min and max ns from the DI0 edge to the update pulse of each bus
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -174,8 +240,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x33
-#define APP_NBYTES_OF_REG_BANK              404
+#define APP_REGS_ADD_MAX                    0x58
+#define APP_NBYTES_OF_REG_BANK              821
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -184,10 +250,12 @@ typedef struct
 #define B_RGB_OFF                          (1<<1)       // RGB to OFF
 #define B_DEMO_MODE_ON                     (1<<2)       // Start demonstration mode
 #define B_DEMO_MODE_OFF                    (1<<3)       // Stop demonstration mode
-#define MSK_DI0_SEL                        (3<<0)       // 
+#define MSK_DI0_SEL                        (7<<0)       // 
 #define GM_DI0_SYNC                        (0<<0)       // Use as a pure digital input
 #define GM_DI0_RISE_UPDATE_RGBS            (1<<0)       // Update RGBs with a rising edge
 #define GM_DI0_HIGH_RGBS_ON                (2<<0)       // Able to update RGBs when the pin is HIGH. Turn LEDs off when rising edge is detected.
+#define GM_DI0_STEP_FRAMES                 (3<<0)       // Show the next frame of the ring with a rising edge
+#define GM_DI0_RISE_UPDATE_EVENTS          (4<<0)       // Update RGBs with a rising edge routed by the event system and the DMA
 #define MSK_DO_SEL                         (7<<0)       // 
 #define GM_DO_DIG                          (0<<0)       // Use as a pure digital output
 #define GM_DO_PULSE_WHEN_UPDATED           (1<<0)       // Pulse 1 ms when the RGBs are updated
@@ -202,5 +270,39 @@ typedef struct
 #define B_DO4                              (1<<4)       // 
 #define B_EVT_LED_STATUS                   (1<<0)       // Event of register EVT_LED_STATUS
 #define B_EVT_INPUTS_STATE                 (1<<1)       // Event of register EVT_INPUTS_STATE
+#define B_EVT_DISPLAY_TIME                 (1<<2)       // Event of register DISPLAY_TIME
+#define B_EVT_FRAME_CRC                    (1<<3)       // Event of register FRAME_CRC
+#define B_SCATTER_BUS1                     (1<<7)       // The LED of the scatter list is on bus 1
+#define MSK_SCATTER_INDEX                  (0x7F<<0)    // Index of the LED of the scatter list
+#define SCATTER_END                        0xFF         // Ends the scatter list
+#define B_SEQ_CLEAR                        (1<<0)       // Remove all frames of the stored sequence
+#define B_SEQ_REWIND                       (1<<1)       // The next update shows the first frame of the sequence
+#define B_SEQ_PLAY                         (1<<2)       // Each update shows the next frame of the sequence
+#define B_SEQ_STOP                         (1<<3)       // The updates show the last loaded frame again
+#define GM_EFFECT_NONE                     0            // Stop the effect
+#define GM_EFFECT_SOLID                    1            // All LEDs with the color
+#define GM_EFFECT_CHASE                    2            // Span LEDs with the color going around the bus
+#define GM_EFFECT_FADE                     3            // All LEDs fading in and out linearly
+#define GM_EFFECT_RAINBOW                  4            // A rainbow going around the bus
+#define GM_EFFECT_BREATHING                5            // All LEDs fading in and out, slow near off
+#define B_PAGE_BUS1                        (1<<0)       // The page is for the bus 1
+#define B_PAGE_COMMIT                      (1<<1)       // Show the frame on both buses after the page
+#define MAX_EXTENDED_LEDS                  400          // Length of the frames of the slaves
+#define B_BUS0                             (1<<0)       // Bus 0
+#define B_BUS1                             (1<<1)       // Bus 1
+#define FRAME_RING_SIZE                    2            // Frames on the ring, as many as the RAM left by the core allows
+#define MIN_PULSE_TIME_US                  100          // Shortest on or off time of the pulse train
+#define MAX_PULSE_TIME_US                  1000000000   // Longest on or off time of the pulse train
+#define DISPLAY_QUARTER_US_PER_LED         166          // 41.5 us of the asm kernel, for the slaves without link info
+#define DISPLAY_US_PER_STRIP_LED           31           // 24 bits of 1.25 us on the parallel strips and their mask
+#define DISPLAY_LATCH_US                   60           // Slave start and the WS2812 reset after the last LED
+#define LOAD_TIMEOUT_MS                    50           // Longest wait for the load of the other bus
+#define GM_LINK_1MBPS                      0            // 1 Mb/s
+#define GM_LINK_2MBPS                      1            // 2 Mb/s
+#define GM_LINK_4MBPS                      2            // 4 Mb/s
+#define MSK_LINK_SPEED                     (3<<0)       // Speed of the link
+#define B_LINK_V2                          (1<<2)       // The link uses the v2 framing, with CRC
+#define B_LINK_BUSY                        (1<<3)       // The speed is being negotiated
+#define PALETTE_ENTRIES                    64           // Entries of the palette of the slaves
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
@@ -32,48 +32,225 @@ extern AppRegs app_regs;
 #define EVENT_LOAD_DONE 0xA1
 #define EVENT_LEDS_UPDATED 0xA2
 #define EVENT_LEDS_OFF 0xA3
+#define EVENT_FRAME_STORED 0xA4
+#define EVENT_STORE_FULL 0xA5
+#define EVENT_LINK_INFO 0xA6
+#define EVENT_LINK_ERROR 0xA7
+#define EVENT_LINK_SWITCH 0xA8
+#define EVENT_LINK_HEALTH 0xA9
+#define EVENT_LEDS_UPDATED_CRC 0xAA
 
 /************************************************************************/
 /* UARTS                                                                */
 /************************************************************************/
-void load_was_done (void);
-void leds_were_updated (void);
+void load_was_done (uint8_t bus);
+void leds_were_updated (uint8_t bus);
 void leds_were_turned_off (void);
 
-void uart0_rcv_byte_callback(uint8_t byte) {}
+extern uint8_t sequence_frames[2];
+extern uint8_t loads_pending;
+
+bool presentation_was_loaded (void);
+void present_frame (void);
+void pulse_train_compare (void);
+void tce0_edges_were_made (void);
+bool ring_frame_was_loaded (void);
+void step_frame_ring (void);
+void mark_display_time (void);
+void report_display_time (void);
+void frame_was_loaded (void);
+void frame_was_displayed (void);
+void measure_latch_skew (uint8_t bus);
+void start_do_pulse (uint8_t output);
+void do_pulse_was_ended (uint8_t output);
+void update_latency_was_captured (void);
+
+void link_info_was_received (uint8_t bus, uint8_t version, uint8_t max_speed, uint8_t quarter_us_per_led);
+void link_switch_was_acked (uint8_t bus);
+void link_error_was_received (uint8_t bus);
+void link_health_was_received (uint8_t bus, uint8_t * errors);
+void link_uart_error_was_seen (uint8_t bus);
+void link_noise_was_received (uint8_t bus);
+
+void frame_crc_was_received (uint8_t bus, uint16_t crc);
+
+/*
+* Some events are followed by data: EVENT_LINK_INFO by the version, the max speed
+* and the time of each LED of the slave, EVENT_LEDS_UPDATED_CRC by the CRC of the frame, LSB first, and
+* EVENT_LINK_HEALTH by the 4 error counters of the slave.
+* The slaves without the CRC send a bare EVENT_LEDS_UPDATED.
+*/
+uint8_t event_with_data[2];
+uint8_t event_data[2][4];
+uint8_t event_data_size[2];
+uint8_t event_data_left[2] = {0, 0};
+
+static bool event_data_byte (uint8_t bus, uint8_t byte)
+{
+   if (event_data_left[bus] == 0)
+      return false;
+   
+   event_data[bus][event_data_size[bus] - event_data_left[bus]] = byte;
+   
+   if (--event_data_left[bus] == 0)
+   {
+      if (event_with_data[bus] == EVENT_LINK_INFO)
+         link_info_was_received(bus, event_data[bus][0], event_data[bus][1], event_data[bus][2]);
+      else if (event_with_data[bus] == EVENT_LEDS_UPDATED_CRC)
+         frame_crc_was_received(bus, event_data[bus][0] | (event_data[bus][1] << 8));
+      else
+         link_health_was_received(bus, event_data[bus]);
+   }
+   
+   return true;
+}
+
+static void wait_event_data (uint8_t bus, uint8_t event, uint8_t size)
+{
+   event_with_data[bus] = event;
+   event_data_size[bus] = size;
+   event_data_left[bus] = size;
+}
+
+void uart0_rcv_error_callback(void) {link_uart_error_was_seen(0);}
+void uart1_rcv_error_callback(void) {link_uart_error_was_seen(1);}
+
+/* Each bus reports its own loads, updates and stored frames, only the bus 1 reports the LEDs off */
+void uart0_rcv_byte_callback(uint8_t byte)
+{
+   if (event_data_byte(0, byte)) return;
+   
+   if (byte == EVENT_LOAD_DONE) load_was_done(B_BUS0);
+   if (byte == EVENT_LEDS_UPDATED) leds_were_updated(B_BUS0);
+   if (byte == EVENT_LEDS_UPDATED_CRC) {leds_were_updated(B_BUS0); wait_event_data(0, byte, 2);}
+   if (byte == EVENT_FRAME_STORED) sequence_frames[0]++;
+   if (byte == EVENT_LINK_INFO) wait_event_data(0, byte, 3);
+   if (byte == EVENT_LINK_SWITCH) link_switch_was_acked(0);
+   if (byte == EVENT_LINK_ERROR) link_error_was_received(0);
+   if (byte == EVENT_LINK_HEALTH) wait_event_data(0, byte, 4);
+   if (byte < EVENT_LOAD_DONE || byte > EVENT_LEDS_UPDATED_CRC) link_noise_was_received(0);
+}
 void uart1_rcv_byte_callback(uint8_t byte)
 {
-   if (byte == EVENT_LOAD_DONE) load_was_done(); 
-   if (byte == EVENT_LEDS_UPDATED) leds_were_updated();
+   if (event_data_byte(1, byte)) return;
+   
+   if (byte == EVENT_LOAD_DONE) load_was_done(B_BUS1); 
+   if (byte == EVENT_LEDS_UPDATED) leds_were_updated(B_BUS1);
+   if (byte == EVENT_LEDS_UPDATED_CRC) {leds_were_updated(B_BUS1); wait_event_data(1, byte, 2);}
    if (byte == EVENT_LEDS_OFF) leds_were_turned_off();
+   if (byte == EVENT_FRAME_STORED) sequence_frames[1]++;
+   if (byte == EVENT_LINK_INFO) wait_event_data(1, byte, 3);
+   if (byte == EVENT_LINK_SWITCH) link_switch_was_acked(1);
+   if (byte == EVENT_LINK_ERROR) link_error_was_received(1);
+   if (byte == EVENT_LINK_HEALTH) wait_event_data(1, byte, 4);
+   if (byte < EVENT_LOAD_DONE || byte > EVENT_LEDS_UPDATED_CRC) link_noise_was_received(1);
 }
 
 /************************************************************************/
 /* Clear DO0 and DO1 pins                                               */
 /************************************************************************/
-ISR(TCC0_OVF_vect, ISR_NAKED) {timer_type0_stop(&TCC0); clr_DO0; reti();}
-ISR(TCD0_OVF_vect, ISR_NAKED) {timer_type0_stop(&TCD0); clr_DO1; reti();}
+ISR(TCC0_CCA_vect, ISR_NAKED) {do_pulse_was_ended(0); reti();}
+ISR(TCC0_CCB_vect, ISR_NAKED) {do_pulse_was_ended(1); reti();}
+
+/************************************************************************/
+/* Latency from DI0 to the update lines                                 */
+/************************************************************************/
+ISR(TCD0_CCC_vect, ISR_NAKED) {update_latency_was_captured(); reti();}
+
+/************************************************************************/
+/* Presentation time of the scheduled frame and pulse train             */
+/************************************************************************/
+/* The edges are made on the high level, so these can't be naked like the low level ones */
+ISR(TCE0_CCA_vect) {present_frame();}
+ISR(TCE0_CCB_vect) {pulse_train_compare();}
+ISR(TCE0_CCC_vect, ISR_NAKED) {tce0_edges_were_made(); reti();}
 
 /************************************************************************/
 /* Slave has a new set of data for the LEDs                             */
 /************************************************************************/
-void load_was_done (void)
+uint8_t loads_done = 0;          // Buses loaded since the last update
+uint8_t loads_timed_out = 0;     // Buses updated without their load
+uint8_t load_wait_ms = 0;        // Time waiting for the other bus
+uint8_t updates_reporter = B_BUS1;  // Bus that reports the last update
+
+static void buses_were_loaded (void);
+
+/*
+* Unless the buses are independent, a bus waits for the other one if it is also
+* loading a frame, so both are updated together.
+*/
+void load_was_done (uint8_t bus)
+{
+   /* Its frame is shown on the next update */
+   if (loads_timed_out & bus)
+   {
+      loads_timed_out &= ~bus;
+      return;
+   }
+   
+   loads_pending &= ~bus;
+   loads_done |= bus;
+   load_wait_ms = 0;
+   
+   if (!app_regs.REG_INDEPENDENT_BUSES && loads_pending)
+      return;
+   
+   buses_were_loaded();
+}
+
+/*
+* Called each ms. A bus that doesn't load in time is updated anyway with the
+* other one, showing its last loaded frame.
+*/
+void check_load_timeout (void)
+{
+   if (app_regs.REG_INDEPENDENT_BUSES || !loads_done || !loads_pending)
+      return;
+   
+   if (++load_wait_ms < LOAD_TIMEOUT_MS)
+      return;
+   
+   loads_timed_out |= loads_pending;
+   loads_done |= loads_pending;
+   loads_pending = 0;
+   load_wait_ms = 0;
+   app_regs.REG_LOAD_TIMEOUTS++;
+   
+   buses_were_loaded();
+}
+
+static void buses_were_loaded (void)
 {
+   frame_was_loaded();
+   
+   /* The scheduled frames wait for the presentation time and the frames of the ring for a step */
+   if (presentation_was_loaded() || ring_frame_was_loaded())
+   {
+      loads_done = 0;
+      return;
+   }
+   
+   uint8_t buses = loads_done;
+   loads_done = 0;
+   
+   /* With both buses updated, one of them is enough to report it */
+   updates_reporter = (buses & B_BUS1) ? B_BUS1 : B_BUS0;
+   
    if (app_regs.REG_LATCH_NEXT_UPDATE== 0)
    {
       if ((app_regs.REG_DI0_CONF == GM_DI0_SYNC) ||
           (app_regs.REG_DI0_CONF == GM_DI0_HIGH_RGBS_ON && read_DI0))
       {
-         set_UPDATE_LEDS0;
-         set_UPDATE_LEDS1;
+         if (buses & B_BUS0) set_UPDATE_LEDS0;
+         if (buses & B_BUS1) set_UPDATE_LEDS1;
          clr_UPDATE_LEDS0;
          clr_UPDATE_LEDS1;
+         mark_display_time();
       }
    
       if (app_regs.REG_DO0_CONF == GM_DO_PULSE_WHEN_ARRAY_LOADED)
       {
-         timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV256, 125, INT_LEVEL_LOW);
-         set_DO0;
+         start_do_pulse(0);
       }
       if (app_regs.REG_DO0_CONF == GM_DO_TOGGLE_WHEN_ARRAY_LOADED)
       {
@@ -82,8 +259,7 @@ void load_was_done (void)
    
       if (app_regs.REG_DO1_CONF == GM_DO_PULSE_WHEN_ARRAY_LOADED)
       {  
-         timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV256, 125, INT_LEVEL_LOW);
-         set_DO1;
+         start_do_pulse(1);
       }
       if (app_regs.REG_DO1_CONF == GM_DO_TOGGLE_WHEN_ARRAY_LOADED)
       {
@@ -99,18 +275,25 @@ void load_was_done (void)
 /************************************************************************/
 /* LEDS were updated                                                    */
 /************************************************************************/
-void leds_were_updated (void)
+void leds_were_updated (uint8_t bus)
 {
+   measure_latch_skew(bus);
+   
+   if (bus != updates_reporter)
+      return;
+   
    if (app_regs.REG_EVNT_ENABLE & B_EVT_LED_STATUS)
    {
       app_regs.REG_LEDS_STATUS = B_RGB_ON;
       core_func_send_event(ADD_REG_LEDS_STATUS, true);
    }
    
+   report_display_time();
+   frame_was_displayed();
+   
    if (app_regs.REG_DO0_CONF == GM_DO_PULSE_WHEN_UPDATED)
    {
-      timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV256, 125, INT_LEVEL_LOW);
-      set_DO0;
+      start_do_pulse(0);
    }
    if (app_regs.REG_DO0_CONF == GM_DO_TOGGLE_WHEN_UPDATED)
    {
@@ -119,8 +302,7 @@ void leds_were_updated (void)
       
    if (app_regs.REG_DO1_CONF == GM_DO_PULSE_WHEN_UPDATED)
    {
-      timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV256, 125, INT_LEVEL_LOW);
-      set_DO1;
+      start_do_pulse(1);
    }
    if (app_regs.REG_DO1_CONF == GM_DO_TOGGLE_WHEN_UPDATED)
    {
@@ -128,6 +310,17 @@ void leds_were_updated (void)
    }
 }
 
+/*
+* The CRC arrives right after the update, so the bus that reports the update also sends its event.
+*/
+void frame_crc_was_received (uint8_t bus, uint16_t crc)
+{
+   app_regs.REG_FRAME_CRC[bus] = crc;
+   
+   if (((bus == 0) ? B_BUS0 : B_BUS1) == updates_reporter && (app_regs.REG_EVNT_ENABLE & B_EVT_FRAME_CRC))
+      core_func_send_event(ADD_REG_FRAME_CRC, true);
+}
+
 /************************************************************************/
 /* LEDS were updated                                                    */
 /************************************************************************/
@@ -147,7 +340,8 @@ ISR(PORTA_INT0_vect, ISR_NAKED)
 {
    uint8_t reg = read_DI0 ? B_DI0 : 0;   
    
-   if (app_regs.REG_INPUTS_STATE == reg)
+   /* When the event system takes DI0, only its rising edges are sensed and all are reported */
+   if (app_regs.REG_INPUTS_STATE == reg && app_regs.REG_DI0_CONF != GM_DI0_RISE_UPDATE_EVENTS)
    {
       reti();
    }
@@ -167,6 +361,18 @@ ISR(PORTA_INT0_vect, ISR_NAKED)
       set_UPDATE_LEDS1;
       clr_UPDATE_LEDS0;
       clr_UPDATE_LEDS1;
+      mark_display_time();
+   }
+   
+   /* The DMA pulsed the update lines already, a few us earlier */
+   if (app_regs.REG_DI0_CONF == GM_DI0_RISE_UPDATE_EVENTS)
+   {
+      mark_display_time();
+   }
+   
+   if ((app_regs.REG_DI0_CONF == GM_DI0_STEP_FRAMES) && reg)
+   {
+      step_frame_ring();
    }
    
    if ((app_regs.REG_DI0_CONF == GM_DI0_HIGH_RGBS_ON) && reg)
@@ -175,6 +381,7 @@ ISR(PORTA_INT0_vect, ISR_NAKED)
       set_UPDATE_LEDS1;
       clr_UPDATE_LEDS0;
       clr_UPDATE_LEDS1;
+      mark_display_time();
    }
    
    if ((app_regs.REG_DI0_CONF == GM_DI0_HIGH_RGBS_ON) && !reg)
@@ -16,6 +16,12 @@ uint8_t rxbuff_uart0[UART0_RXBUFSIZ];
 	uint8_t uart0_head = 0;
 #endif
 
+uint16_t uart0_frame_siz = 0;											// size of the last frame, 0 if it's not the last data
+
+#ifdef UART0_USE_DMA
+	uint16_t uart0_dma_siz = 0;										// bytes being sent by the DMA, 0 if it's idle
+#endif
+
 #if UART0_RXBUFSIZ > 256
 	uint16_t uart0_rx_pointer = 0;
 #else
@@ -43,6 +49,15 @@ void uart0_init(uint16_t BSEL, int8_t BSCALE, bool use_clk2x)
 	if (use_clk2x)
 		UART0_UART.CTRLB |= USART_CLK2X_bm;
 	
+	#ifdef UART0_USE_DMA
+		DMA.CTRL |= DMA_ENABLE_bm;
+		UART0_DMA_CH.DESTADDR0 = ((uint16_t)&UART0_UART.DATA) & 0xFF;
+		UART0_DMA_CH.DESTADDR1 = ((uint16_t)&UART0_UART.DATA) >> 8;
+		UART0_DMA_CH.DESTADDR2 = 0;
+		UART0_DMA_CH.ADDRCTRL = DMA_CH_SRCRELOAD_NONE_gc | DMA_CH_SRCDIR_INC_gc | DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc;
+		UART0_DMA_CH.CTRLB = UART0_DMA_INT_LEVEL;
+	#endif
+	
 	set_io(UART0_PORT, UART0_TX_pin);
 	io_pin2out(&UART0_PORT, UART0_TX_pin, OUT_IO_DIGITAL, IN_EN_IO_DIS);
 	io_pin2in(&UART0_PORT, UART0_RX_pin, PULL_IO_TRISTATE, SENSE_IO_NO_INT_USED);
@@ -69,6 +84,68 @@ void uart0_disable(void)
 /************************************************************************/
 /* Interrupt TX                                                         */
 /************************************************************************/
+#ifdef UART0_USE_DMA
+/*
+* The DMA sends the bytes from the tail up to the head, or up to the end of the
+* buffer, with one transfer. The bytes being sent belong to the DMA until it ends.
+*/
+static bool uart0_cts_is_low (void)
+{
+	#ifdef UART0_USE_FLOW_CONTROL
+		return (UART0_CTS_PORT.IN & (1 << UART0_CTS_pin)) ? false : true;
+	#else
+		return true;
+	#endif
+}
+
+static void uart0_dma_start (void)
+{
+	if (uart0_dma_siz || uart0_head == uart0_tail)
+		return;
+	
+	uart0_dma_siz = (uart0_head > uart0_tail) ? uart0_head - uart0_tail : UART0_TXBUFSIZ - uart0_tail;
+	
+	UART0_DMA_CH.SRCADDR0 = ((uint16_t)(txbuff_uart0 + uart0_tail)) & 0xFF;
+	UART0_DMA_CH.SRCADDR1 = ((uint16_t)(txbuff_uart0 + uart0_tail)) >> 8;
+	UART0_DMA_CH.SRCADDR2 = 0;
+	UART0_DMA_CH.TRFCNT = uart0_dma_siz;
+	
+	/* Without a trigger the transfer waits for the CTS */
+	UART0_DMA_CH.TRIGSRC = uart0_cts_is_low() ? UART0_DMA_TRIGSRC : DMA_CH_TRIGSRC_OFF_gc;
+	UART0_DMA_CH.CTRLA = DMA_CH_ENABLE_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+}
+
+static void uart0_dma_done (void)
+{
+	UART0_DMA_CH.CTRLB |= DMA_CH_TRNIF_bm;
+	
+	uart0_tail += uart0_dma_siz;
+	if (uart0_tail == UART0_TXBUFSIZ)
+		uart0_tail = 0;
+	uart0_dma_siz = 0;
+	
+	uart0_dma_start();
+}
+
+UART0_DMA_ROUTINE_
+{
+	uart0_dma_done();
+	uart0_leave_interrupt;
+}
+
+/* Hold the DMA interrupt, so the tail doesn't move, and start the DMA when released */
+#define hold_uart0_tx		UART0_DMA_CH.CTRLB &= ~DMA_CH_TRNINTLVL_gm
+#define release_uart0_tx	do { uart0_dma_start(); UART0_DMA_CH.CTRLB |= UART0_DMA_INT_LEVEL; } while (0)
+
+#else
+/* Hold the TX interrupt, so the tail doesn't move, and enable it when released */
+#define hold_uart0_tx		UART0_UART.CTRLA &= ~(USART_DREINTLVL_OFF_gc | USART_DREINTLVL_gm)
+#ifdef UART0_USE_FLOW_CONTROL
+	#define release_uart0_tx	if (!(UART0_CTS_PORT.IN & (1 << UART0_CTS_pin)) && uart0_tail != uart0_head) UART0_UART.CTRLA |= UART0_TX_INT_LEVEL
+#else
+	#define release_uart0_tx	if (uart0_tail != uart0_head) UART0_UART.CTRLA |= UART0_TX_INT_LEVEL
+#endif
+
 UART0_TX_ROUTINE_
 {
 	disable_uart0_rx;
@@ -85,19 +162,25 @@ UART0_TX_ROUTINE_
 
 	uart0_leave_interrupt;
 }
+#endif
 
 /************************************************************************/
 /* Interrupt CTS                                                        */
 /************************************************************************/
 UART0_CTS_ROUTINE_
 {
-	if (UART0_CTS_PORT.IN & (1 << UART0_CTS_pin) )
-		/* Disable uart interrupt until RTS is logic low */
-		UART0_UART.CTRLA &= ~(USART_DREINTLVL_OFF_gc | USART_DREINTLVL_gm);
-	else
-		if (uart0_tail != uart0_head)
-			/* If the buffer is not empty, enable Tx interrupt */
-			UART0_UART.CTRLA |= UART0_TX_INT_LEVEL;
+	#ifdef UART0_USE_DMA
+		/* The transfer stops between two bytes while its trigger is off */
+		UART0_DMA_CH.TRIGSRC = uart0_cts_is_low() ? UART0_DMA_TRIGSRC : DMA_CH_TRIGSRC_OFF_gc;
+	#else
+		if (UART0_CTS_PORT.IN & (1 << UART0_CTS_pin) )
+			/* Disable uart interrupt until RTS is logic low */
+			UART0_UART.CTRLA &= ~(USART_DREINTLVL_OFF_gc | USART_DREINTLVL_gm);
+		else
+			if (uart0_tail != uart0_head)
+				/* If the buffer is not empty, enable Tx interrupt */
+				UART0_UART.CTRLA |= UART0_TX_INT_LEVEL;
+	#endif
 
 	uart0_leave_interrupt;
 }
@@ -105,9 +188,9 @@ UART0_CTS_ROUTINE_
 /************************************************************************/
 /* Send data                                                            */
 /************************************************************************/
-void uart0_xmit_now(const uint8_t *dataIn0, uint8_t siz)
+void uart0_xmit_now(const uint8_t *dataIn0, uint16_t siz)
 {
-	for (uint8_t i = 0; i < siz; i++) {
+	for (uint16_t i = 0; i < siz; i++) {
 		loop_until_bit_is_set(UART0_UART.STATUS, USART_DREIF_bp);
 		UART0_UART.DATA = dataIn0[i];
 	}
@@ -119,12 +202,28 @@ void uart0_xmit_now_byte(const uint8_t byte)
 	UART0_UART.DATA = byte;
 }
 
-void uart0_xmit(const uint8_t *dataIn0, uint8_t siz)
+void uart0_xmit(const uint8_t *dataIn0, uint16_t siz)
 {
+	uart0_frame_siz = 0;												// the frame is no longer the last data in the buffer
+	
+	if (siz >= UART0_TXBUFSIZ)										// only the newest bytes fit in the buffer
+	{
+		dataIn0 += siz - (UART0_TXBUFSIZ - 1);
+		siz = UART0_TXBUFSIZ - 1;
+	}
+	
+	#ifdef UART0_USE_DMA
+		/* The bytes being sent by the DMA can't be overwritten, so the newest bytes are lost */
+		hold_uart0_tx;
+		uint16_t free = UART0_TXBUFSIZ - 1 - (UART0_TXBUFSIZ + uart0_head - uart0_tail) % UART0_TXBUFSIZ;
+		if (siz > free)
+			siz = free;
+	#else
 	#ifdef UART0_USE_FLOW_CONTROL
 		if (!(UART0_CTS_PORT.IN & (1 << UART0_CTS_pin)))
 	#endif
 			UART0_UART.CTRLA |= UART0_TX_INT_LEVEL;	// Re-enable TX interrupt
+	#endif
 	
 	
 	uint16_t space = UART0_TXBUFSIZ - uart0_head;
@@ -159,6 +258,93 @@ void uart0_xmit(const uint8_t *dataIn0, uint8_t siz)
 			if (uart0_tail == UART0_TXBUFSIZ)    uart0_tail = 0;
 		}
 	}
+	
+	#ifdef UART0_USE_DMA
+		release_uart0_tx;
+	#endif
+}
+
+/************************************************************************/
+/* Send frames                                                          */
+/************************************************************************/
+/*
+* Bytes waiting on the buffer that were not started yet. Call it with the TX held.
+*/
+static uint16_t uart0_waiting (void)
+{
+	uint16_t used = (UART0_TXBUFSIZ + uart0_head - uart0_tail) % UART0_TXBUFSIZ;
+	
+	#ifdef UART0_USE_DMA
+		used -= uart0_dma_siz;											// the bytes with the DMA were already started
+	#endif
+	
+	return used;
+}
+
+/*
+* A frame replaces the previous one while it is still the last data in the buffer
+* and its first byte was not sent yet. A frame is never cut, if it doesn't fit in
+* the buffer it's dropped and the buffer is left untouched.
+* Returns UART0_FRAME_QUEUED, UART0_FRAME_REPLACED or UART0_FRAME_DROPPED.
+*/
+uint8_t uart0_xmit_frame(const uint8_t *header, uint16_t header_siz, const uint8_t *data, uint16_t data_siz)
+{
+	uint16_t siz = header_siz + data_siz;
+	uint8_t result = UART0_FRAME_QUEUED;
+	
+	/* The tail doesn't move while the buffer is checked */
+	hold_uart0_tx;
+	
+	uint16_t used = (UART0_TXBUFSIZ + uart0_head - uart0_tail) % UART0_TXBUFSIZ;
+	uint16_t space = UART0_TXBUFSIZ - 1 - used;
+	
+	if (uart0_frame_siz && uart0_waiting() >= uart0_frame_siz && siz <= space + uart0_frame_siz)
+	{
+		uart0_head = (UART0_TXBUFSIZ + uart0_head - uart0_frame_siz) % UART0_TXBUFSIZ;
+		space += uart0_frame_siz;
+		result = UART0_FRAME_REPLACED;
+	}
+	
+	if (siz > space)
+	{
+		release_uart0_tx;
+		return UART0_FRAME_DROPPED;
+	}
+	
+	uart0_xmit(header, header_siz);
+	uart0_xmit(data, data_siz);
+	uart0_frame_siz = siz;
+	
+	return result;
+}
+
+/*
+* True while the last frame can still be replaced by a new one.
+*/
+bool uart0_frame_is_waiting(void)
+{
+	hold_uart0_tx;
+	bool waiting = uart0_frame_siz && uart0_waiting() >= uart0_frame_siz;
+	release_uart0_tx;
+	
+	return waiting;
+}
+
+/*
+* Sends the data only if it fits whole in the buffer. Returns false if it doesn't.
+*/
+bool uart0_xmit_whole(const uint8_t *data, uint16_t siz)
+{
+	hold_uart0_tx;
+	
+	if (siz > UART0_TXBUFSIZ - 1 - (UART0_TXBUFSIZ + uart0_head - uart0_tail) % UART0_TXBUFSIZ)
+	{
+		release_uart0_tx;
+		return false;
+	}
+	
+	uart0_xmit(data, siz);
+	return true;
 }
 
 /************************************************************************/
@@ -186,6 +372,10 @@ extern uint8_t rx[];
 
 UART0_RX_ROUTINE_
 {
+	/* The errors are the ones of the byte on DATA, so they are read before it */
+	if (UART0_UART.STATUS & (USART_FERR_bm | USART_BUFOVF_bm))
+		uart0_rcv_error_callback();
+	
 	//disable_uart0_rx;
 	uart0_rcv_byte_callback(UART0_DATA);
 	//enable_uart0_rx;
@@ -33,8 +33,19 @@
 #define UART0_CTS_ROUTINE_		ISR(PORTD_INT0_vect, ISR_NAKED)
 #define UART0_CTS_INT_N			0
 
+#define UART0_USE_DMA			// comment this line to send with the TX interrupt
+#define UART0_DMA_CH			DMA.CH0
+#define UART0_DMA_TRIGSRC		DMA_CH_TRIGSRC_USARTD0_DRE_gc
+#define UART0_DMA_INT_LEVEL		INT_LEVEL_LOW
+#define UART0_DMA_ROUTINE_		ISR(DMA_CH0_vect, ISR_NAKED)
+
 #define uart0_leave_interrupt /*return*/reti()
 
+/* What uart0_xmit_frame() did with the frame */
+#define UART0_FRAME_QUEUED	0
+#define UART0_FRAME_REPLACED	1	// queued in place of the frame still waiting
+#define UART0_FRAME_DROPPED	2	// didn't fit, nothing was queued
+
 /************************************************************************/
 /* Prototypes                                                           */
 /************************************************************************/
@@ -45,11 +56,15 @@ void uart0_init(uint16_t BSEL, int8_t BSCALE, bool use_clk2x);
 void uart0_enable(void);
 void uart0_disable();
 
-void uart0_xmit_now(const uint8_t *dataIn0, uint8_t siz);
+void uart0_xmit_now(const uint8_t *dataIn0, uint16_t siz);
 void uart0_xmit_now_byte(const uint8_t byte);
-void uart0_xmit(const uint8_t *dataIn0, uint8_t siz);
+void uart0_xmit(const uint8_t *dataIn0, uint16_t siz);
+uint8_t uart0_xmit_frame(const uint8_t *header, uint16_t header_siz, const uint8_t *data, uint16_t data_siz);
+bool uart0_frame_is_waiting(void);
+bool uart0_xmit_whole(const uint8_t *data, uint16_t siz);
 
 void uart0_rcv_byte_callback(uint8_t byte);
+void uart0_rcv_error_callback(void);
 bool uart0_rcv_now(uint8_t * byte);
 
 #endif /* _UART0_H_ */
@@ -16,6 +16,12 @@ uint8_t rxbuff_uart1[UART1_RXBUFSIZ];
 	uint8_t uart1_head = 0;
 #endif
 
+uint16_t uart1_frame_siz = 0;											// size of the last frame, 0 if it's not the last data
+
+#ifdef UART1_USE_DMA
+	uint16_t uart1_dma_siz = 0;										// bytes being sent by the DMA, 0 if it's idle
+#endif
+
 #if UART1_RXBUFSIZ > 256
 	uint16_t uart1_rx_pointer = 0;
 #else
@@ -43,6 +49,15 @@ void uart1_init(uint16_t BSEL, int8_t BSCALE, bool use_clk2x)
 	if (use_clk2x)
 		UART1_UART.CTRLB |= USART_CLK2X_bm;
 	
+	#ifdef UART1_USE_DMA
+		DMA.CTRL |= DMA_ENABLE_bm;
+		UART1_DMA_CH.DESTADDR0 = ((uint16_t)&UART1_UART.DATA) & 0xFF;
+		UART1_DMA_CH.DESTADDR1 = ((uint16_t)&UART1_UART.DATA) >> 8;
+		UART1_DMA_CH.DESTADDR2 = 0;
+		UART1_DMA_CH.ADDRCTRL = DMA_CH_SRCRELOAD_NONE_gc | DMA_CH_SRCDIR_INC_gc | DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc;
+		UART1_DMA_CH.CTRLB = UART1_DMA_INT_LEVEL;
+	#endif
+	
 	set_io(UART1_PORT, UART1_TX_pin);
 	io_pin2out(&UART1_PORT, UART1_TX_pin, OUT_IO_DIGITAL, IN_EN_IO_DIS);
 	io_pin2in(&UART1_PORT, UART1_RX_pin, PULL_IO_TRISTATE, SENSE_IO_NO_INT_USED);
@@ -69,6 +84,68 @@ void uart1_disable(void)
 /************************************************************************/
 /* Interrupt TX                                                         */
 /************************************************************************/
+#ifdef UART1_USE_DMA
+/*
+* The DMA sends the bytes from the tail up to the head, or up to the end of the
+* buffer, with one transfer. The bytes being sent belong to the DMA until it ends.
+*/
+static bool uart1_cts_is_low (void)
+{
+	#ifdef UART1_USE_FLOW_CONTROL
+		return (UART1_CTS_PORT.IN & (1 << UART1_CTS_pin)) ? false : true;
+	#else
+		return true;
+	#endif
+}
+
+static void uart1_dma_start (void)
+{
+	if (uart1_dma_siz || uart1_head == uart1_tail)
+		return;
+	
+	uart1_dma_siz = (uart1_head > uart1_tail) ? uart1_head - uart1_tail : UART1_TXBUFSIZ - uart1_tail;
+	
+	UART1_DMA_CH.SRCADDR0 = ((uint16_t)(txbuff_uart1 + uart1_tail)) & 0xFF;
+	UART1_DMA_CH.SRCADDR1 = ((uint16_t)(txbuff_uart1 + uart1_tail)) >> 8;
+	UART1_DMA_CH.SRCADDR2 = 0;
+	UART1_DMA_CH.TRFCNT = uart1_dma_siz;
+	
+	/* Without a trigger the transfer waits for the CTS */
+	UART1_DMA_CH.TRIGSRC = uart1_cts_is_low() ? UART1_DMA_TRIGSRC : DMA_CH_TRIGSRC_OFF_gc;
+	UART1_DMA_CH.CTRLA = DMA_CH_ENABLE_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+}
+
+static void uart1_dma_done (void)
+{
+	UART1_DMA_CH.CTRLB |= DMA_CH_TRNIF_bm;
+	
+	uart1_tail += uart1_dma_siz;
+	if (uart1_tail == UART1_TXBUFSIZ)
+		uart1_tail = 0;
+	uart1_dma_siz = 0;
+	
+	uart1_dma_start();
+}
+
+UART1_DMA_ROUTINE_
+{
+	uart1_dma_done();
+	uart1_leave_interrupt;
+}
+
+/* Hold the DMA interrupt, so the tail doesn't move, and start the DMA when released */
+#define hold_uart1_tx		UART1_DMA_CH.CTRLB &= ~DMA_CH_TRNINTLVL_gm
+#define release_uart1_tx	do { uart1_dma_start(); UART1_DMA_CH.CTRLB |= UART1_DMA_INT_LEVEL; } while (0)
+
+#else
+/* Hold the TX interrupt, so the tail doesn't move, and enable it when released */
+#define hold_uart1_tx		UART1_UART.CTRLA &= ~(USART_DREINTLVL_OFF_gc | USART_DREINTLVL_gm)
+#ifdef UART1_USE_FLOW_CONTROL
+	#define release_uart1_tx	if (!(UART1_CTS_PORT.IN & (1 << UART1_CTS_pin)) && uart1_tail != uart1_head) UART1_UART.CTRLA |= UART1_TX_INT_LEVEL
+#else
+	#define release_uart1_tx	if (uart1_tail != uart1_head) UART1_UART.CTRLA |= UART1_TX_INT_LEVEL
+#endif
+
 UART1_TX_ROUTINE_
 {
 	disable_uart1_rx;
@@ -85,19 +162,25 @@ UART1_TX_ROUTINE_
 
 	uart1_leave_interrupt;
 }
+#endif
 
 /************************************************************************/
 /* Interrupt CTS                                                        */
 /************************************************************************/
 UART1_CTS_ROUTINE_
 {
-	if (UART1_CTS_PORT.IN & (1 << UART1_CTS_pin) )
-		/* Disable uart interrupt until RTS is logic low */
-		UART1_UART.CTRLA &= ~(USART_DREINTLVL_OFF_gc | USART_DREINTLVL_gm);
-	else
-		if (uart1_tail != uart1_head)
-			/* If the buffer is not empty, enable Tx interrupt */
-			UART1_UART.CTRLA |= UART1_TX_INT_LEVEL;
+	#ifdef UART1_USE_DMA
+		/* The transfer stops between two bytes while its trigger is off */
+		UART1_DMA_CH.TRIGSRC = uart1_cts_is_low() ? UART1_DMA_TRIGSRC : DMA_CH_TRIGSRC_OFF_gc;
+	#else
+		if (UART1_CTS_PORT.IN & (1 << UART1_CTS_pin) )
+			/* Disable uart interrupt until RTS is logic low */
+			UART1_UART.CTRLA &= ~(USART_DREINTLVL_OFF_gc | USART_DREINTLVL_gm);
+		else
+			if (uart1_tail != uart1_head)
+				/* If the buffer is not empty, enable Tx interrupt */
+				UART1_UART.CTRLA |= UART1_TX_INT_LEVEL;
+	#endif
 
 	uart1_leave_interrupt;
 }
@@ -105,9 +188,9 @@ UART1_CTS_ROUTINE_
 /************************************************************************/
 /* Send data                                                            */
 /************************************************************************/
-void uart1_xmit_now(const uint8_t *dataIn0, uint8_t siz)
+void uart1_xmit_now(const uint8_t *dataIn0, uint16_t siz)
 {
-	for (uint8_t i = 0; i < siz; i++) {
+	for (uint16_t i = 0; i < siz; i++) {
 		loop_until_bit_is_set(UART1_UART.STATUS, USART_DREIF_bp);
 		UART1_UART.DATA = dataIn0[i];
 	}
@@ -119,12 +202,28 @@ void uart1_xmit_now_byte(const uint8_t byte)
 	UART1_UART.DATA = byte;
 }
 
-void uart1_xmit(const uint8_t *dataIn0, uint8_t siz)
+void uart1_xmit(const uint8_t *dataIn0, uint16_t siz)
 {
+	uart1_frame_siz = 0;												// the frame is no longer the last data in the buffer
+	
+	if (siz >= UART1_TXBUFSIZ)										// only the newest bytes fit in the buffer
+	{
+		dataIn0 += siz - (UART1_TXBUFSIZ - 1);
+		siz = UART1_TXBUFSIZ - 1;
+	}
+	
+	#ifdef UART1_USE_DMA
+		/* The bytes being sent by the DMA can't be overwritten, so the newest bytes are lost */
+		hold_uart1_tx;
+		uint16_t free = UART1_TXBUFSIZ - 1 - (UART1_TXBUFSIZ + uart1_head - uart1_tail) % UART1_TXBUFSIZ;
+		if (siz > free)
+			siz = free;
+	#else
 	#ifdef UART1_USE_FLOW_CONTROL
 		if (!(UART1_CTS_PORT.IN & (1 << UART1_CTS_pin)))
 	#endif
 			UART1_UART.CTRLA |= UART1_TX_INT_LEVEL;	// Re-enable TX interrupt
+	#endif
 	
 	
 	uint16_t space = UART1_TXBUFSIZ - uart1_head;
@@ -159,6 +258,93 @@ void uart1_xmit(const uint8_t *dataIn0, uint8_t siz)
 			if (uart1_tail == UART1_TXBUFSIZ)    uart1_tail = 0;
 		}
 	}
+	
+	#ifdef UART1_USE_DMA
+		release_uart1_tx;
+	#endif
+}
+
+/************************************************************************/
+/* Send frames                                                          */
+/************************************************************************/
+/*
+* Bytes waiting on the buffer that were not started yet. Call it with the TX held.
+*/
+static uint16_t uart1_waiting (void)
+{
+	uint16_t used = (UART1_TXBUFSIZ + uart1_head - uart1_tail) % UART1_TXBUFSIZ;
+	
+	#ifdef UART1_USE_DMA
+		used -= uart1_dma_siz;											// the bytes with the DMA were already started
+	#endif
+	
+	return used;
+}
+
+/*
+* A frame replaces the previous one while it is still the last data in the buffer
+* and its first byte was not sent yet. A frame is never cut, if it doesn't fit in
+* the buffer it's dropped and the buffer is left untouched.
+* Returns UART1_FRAME_QUEUED, UART1_FRAME_REPLACED or UART1_FRAME_DROPPED.
+*/
+uint8_t uart1_xmit_frame(const uint8_t *header, uint16_t header_siz, const uint8_t *data, uint16_t data_siz)
+{
+	uint16_t siz = header_siz + data_siz;
+	uint8_t result = UART1_FRAME_QUEUED;
+	
+	/* The tail doesn't move while the buffer is checked */
+	hold_uart1_tx;
+	
+	uint16_t used = (UART1_TXBUFSIZ + uart1_head - uart1_tail) % UART1_TXBUFSIZ;
+	uint16_t space = UART1_TXBUFSIZ - 1 - used;
+	
+	if (uart1_frame_siz && uart1_waiting() >= uart1_frame_siz && siz <= space + uart1_frame_siz)
+	{
+		uart1_head = (UART1_TXBUFSIZ + uart1_head - uart1_frame_siz) % UART1_TXBUFSIZ;
+		space += uart1_frame_siz;
+		result = UART1_FRAME_REPLACED;
+	}
+	
+	if (siz > space)
+	{
+		release_uart1_tx;
+		return UART1_FRAME_DROPPED;
+	}
+	
+	uart1_xmit(header, header_siz);
+	uart1_xmit(data, data_siz);
+	uart1_frame_siz = siz;
+	
+	return result;
+}
+
+/*
+* True while the last frame can still be replaced by a new one.
+*/
+bool uart1_frame_is_waiting(void)
+{
+	hold_uart1_tx;
+	bool waiting = uart1_frame_siz && uart1_waiting() >= uart1_frame_siz;
+	release_uart1_tx;
+	
+	return waiting;
+}
+
+/*
+* Sends the data only if it fits whole in the buffer. Returns false if it doesn't.
+*/
+bool uart1_xmit_whole(const uint8_t *data, uint16_t siz)
+{
+	hold_uart1_tx;
+	
+	if (siz > UART1_TXBUFSIZ - 1 - (UART1_TXBUFSIZ + uart1_head - uart1_tail) % UART1_TXBUFSIZ)
+	{
+		release_uart1_tx;
+		return false;
+	}
+	
+	uart1_xmit(data, siz);
+	return true;
 }
 
 /************************************************************************/
@@ -186,6 +372,10 @@ extern uint8_t rx[];
 
 UART1_RX_ROUTINE_
 {
+	/* The errors are the ones of the byte on DATA, so they are read before it */
+	if (UART1_UART.STATUS & (USART_FERR_bm | USART_BUFOVF_bm))
+		uart1_rcv_error_callback();
+	
 	//disable_uart1_rx;
 	uart1_rcv_byte_callback(UART1_DATA);
 	//enable_uart1_rx;
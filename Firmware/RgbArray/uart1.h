@@ -33,8 +33,19 @@
 #define UART1_CTS_ROUTINE_		ISR(PORTD_INT1_vect, ISR_NAKED)
 #define UART1_CTS_INT_N			1
 
+#define UART1_USE_DMA			// comment this line to send with the TX interrupt
+#define UART1_DMA_CH			DMA.CH1
+#define UART1_DMA_TRIGSRC		DMA_CH_TRIGSRC_USARTD1_DRE_gc
+#define UART1_DMA_INT_LEVEL		INT_LEVEL_LOW
+#define UART1_DMA_ROUTINE_		ISR(DMA_CH1_vect, ISR_NAKED)
+
 #define uart1_leave_interrupt /*return*/reti()
 
+/* What uart1_xmit_frame() did with the frame */
+#define UART1_FRAME_QUEUED	0
+#define UART1_FRAME_REPLACED	1	// queued in place of the frame still waiting
+#define UART1_FRAME_DROPPED	2	// didn't fit, nothing was queued
+
 /************************************************************************/
 /* Prototypes                                                           */
 /************************************************************************/
@@ -45,11 +56,15 @@ void uart1_init(uint16_t BSEL, int8_t BSCALE, bool use_clk2x);
 void uart1_enable(void);
 void uart1_disable();
 
-void uart1_xmit_now(const uint8_t *dataIn0, uint8_t siz);
+void uart1_xmit_now(const uint8_t *dataIn0, uint16_t siz);
 void uart1_xmit_now_byte(const uint8_t byte);
-void uart1_xmit(const uint8_t *dataIn0, uint8_t siz);
+void uart1_xmit(const uint8_t *dataIn0, uint16_t siz);
+uint8_t uart1_xmit_frame(const uint8_t *header, uint16_t header_siz, const uint8_t *data, uint16_t data_siz);
+bool uart1_frame_is_waiting(void);
+bool uart1_xmit_whole(const uint8_t *data, uint16_t siz);
 
 void uart1_rcv_byte_callback(uint8_t byte);
+void uart1_rcv_error_callback(void);
 bool uart1_rcv_now(uint8_t * byte);
 
 #endif /* _UART1_H_ */
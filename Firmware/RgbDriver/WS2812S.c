@@ -1,9 +1,24 @@
 #include "WS2812S.h"
+#include <avr/pgmspace.h>
+#include <util/crc16.h>
+
+#ifdef RGB_USE_DMA_ENGINE
+static void init_dma_engine (void);
+#endif
 
 void initialize_rgb (void)
 {
     RGB_PORT.DIR |= (1 << RGB_PIN);
     RGB_PORT_CLR = (1 << RGB_PIN);
+    
+#ifdef RGB_USE_DMA_ENGINE
+    init_dma_engine();
+#endif
+
+#ifdef RGB_USE_PARALLEL_OUTPUT
+    RGB_STRIPS_PORT.DIR = 0xFF;
+    RGB_STRIPS_PORT.OUTCLR = 0xFF;
+#endif
 }
 
 #define XMIT_BYTE asm (             \
@@ -451,27 +466,126 @@ void update_32rgbs (uint8_t * grb_array)
    );
 }
 
+/*
+* Color correction.
+* Each LED is scaled by the brightness and, if enabled, goes through the gamma table
+* right before it is sent, so the frames in RAM keep the colors as received.
+*/
+static const uint8_t gamma_table[256] PROGMEM = {   // 255 * (x/255)^2.2
+     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+     1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+     3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+     6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+    12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+    20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+    30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+    42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+    56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+    73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+    91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+   113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+   137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+   163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+   192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+   223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255
+};
+
+static uint8_t brightness = 255;
+static bool gamma_enabled = false;
+
+void ws2812_set_brightness (uint8_t value)
+{
+   brightness = value;
+}
+
+void ws2812_set_gamma (bool enable)
+{
+   gamma_enabled = enable;
+}
+
+void ws2812_correct_led (uint8_t * grb)
+{
+   if (brightness == 255 && !gamma_enabled)
+      return;
+   
+   for (uint8_t byte = 0; byte < 3; byte++)
+   {
+      uint8_t color = ((uint16_t)grb[byte] * (brightness + 1)) >> 8;
+      
+      if (gamma_enabled)
+         color = pgm_read_byte(&gamma_table[color]);
+      
+      grb[byte] = color;
+   }
+}
+
+/*
+* CRC-16 (0x1021, reflected, initial value 0xFFFF) of the bytes sent on the last transmission.
+* The LEDs are added right after their correction, so it covers the [G][R][B] that left the
+* pin, or the bit planes when the parallel strips are used.
+*/
+static uint16_t frame_crc;
+
+static void add_to_crc (uint8_t * bytes, uint8_t siz)
+{
+   for (uint8_t i = 0; i < siz; i++)
+      frame_crc = _crc_ccitt_update(frame_crc, bytes[i]);
+}
+
+uint16_t ws2812_frame_crc (void)
+{
+   return frame_crc;
+}
+
 /*
 * The function is expecting an array like uint8_t grb_array[available_leds_on_bus][3] where [3] is [G][R][B].
+* With the DMA engine, it returns as soon as the transmission starts and the array must stay
+* untouched until ws2812_bus_done_callback() is called.
 */
+static uint8_t * source_array;
+
+static void array_source (uint16_t led, uint8_t * grb)
+{
+   uint8_t * address = source_array + led*3;
+   
+   grb[0] = address[0];
+   grb[1] = address[1];
+   grb[2] = address[2];
+}
+
 void update_ws2812_bus (uint8_t * grb_array, uint16_t available_leds_on_bus)
 {
+   while (ws2812_bus_is_busy());
+   
+   source_array = grb_array;
+   update_ws2812_bus_from(array_source, available_leds_on_bus);
+}
+
+#ifndef RGB_USE_DMA_ENGINE
+
+bool ws2812_bus_is_busy (void)
+{
+   return false;
+}
+
+/*
+* Sends available_leds_on_bus LEDs, asking each one to the source right before it is sent.
+*/
+void update_ws2812_bus_from (ws2812_source_t source, uint16_t available_leds_on_bus)
+{
+   uint8_t grb[3];
    uint8_t * address;
-   /*
-   asm volatile (
-   "rjmp update_rgb_bus        \n"
    
-   "update_rgb_bus:            \n"
-   "push	r16                   \n"
-   "push	__tmp_reg__           \n"
-   "ldi    r16, 0x20           \n"     // Load 0x20 to R16 -- means output port bit 5
-   );
-   */
+   frame_crc = 0xFFFF;
    
-   for (uint8_t i = 0; i < available_leds_on_bus; i++)
+   for (uint16_t i = 0; i < available_leds_on_bus; i++)
    {
+      source(i, grb);
+      ws2812_correct_led(grb);
+      add_to_crc(grb, 3);
+      
       /* Send address to Z pointer */
-      address = grb_array + i*3;
+      address = grb;
 
       asm volatile (
       "push	r16                   \n"
@@ -492,4 +606,360 @@ void update_ws2812_bus (uint8_t * grb_array, uint16_t available_leds_on_bus)
       "pop    r16                 \n"
       );
    }
-}
\ No newline at end of file
+   
+   ws2812_bus_done_callback();
+}
+
+#else
+
+/*
+* The DMA engine.
+*
+* Each LED is expanded into 24 compare values (one per bit, MSB first) in one of
+* two buffers. DMA channels 0 and 1 run in double buffer mode, triggered by the
+* timer overflow, so every period gets its duty cycle written to CCBBUF and loaded
+* at the next UPDATE. Only the channel 0 is enabled at the start, the hardware
+* enables each channel when the other one finishes. The interrupt of the channel
+* that finished refills its buffer with the next LED while the other one is sending.
+* A single zero value closes the frame, so the pin stays low after the last bit.
+*
+* The refills run on the medium level and only read the frame, which the application
+* leaves alone while the bus is busy. The end of the frame is reported on the low level,
+* like the rest of the application, from the next overflow of the timer, or right away
+* by ws2812_bus_is_busy() if the application is already waiting for the bus.
+*
+* Cost per LED at 32 MHz, counted from the instruction timings:
+*  - asm kernel: 45 (bit 0) or 51 (bit 1) cycles per bit plus the loop overhead,
+*    1100 to 1250 cycles (34 to 39 us) with the CPU fully busy.
+*  - DMA engine: exactly 960 cycles (30 us) on the pin, around 250 of them spent by
+*    the CPU in the refill interrupt.
+*/
+static uint16_t dma_buff[2][24];
+
+static ws2812_source_t dma_source;
+static uint16_t dma_led;
+static uint16_t dma_leds_to_fill;
+static DMA_CH_t * dma_closing_ch;
+static volatile bool dma_busy = false;
+static volatile bool dma_done_pending = false;
+
+static void init_dma_ch (DMA_CH_t * ch, uint16_t * buff)
+{
+   ch->CTRLA = 0;
+   ch->ADDRCTRL = DMA_CH_SRCRELOAD_TRANSACTION_gc | DMA_CH_SRCDIR_INC_gc | DMA_CH_DESTRELOAD_BURST_gc | DMA_CH_DESTDIR_INC_gc;
+   ch->TRIGSRC = DMA_CH_TRIGSRC_TCC1_OVF_gc;
+   
+   ch->SRCADDR0 = ((uint16_t)buff) & 0xFF;
+   ch->SRCADDR1 = ((uint16_t)buff) >> 8;
+   ch->SRCADDR2 = 0;
+   ch->DESTADDR0 = ((uint16_t)&RGB_TIMER.CCBBUF) & 0xFF;
+   ch->DESTADDR1 = ((uint16_t)&RGB_TIMER.CCBBUF) >> 8;
+   ch->DESTADDR2 = 0;
+   
+   ch->CTRLB = DMA_CH_TRNINTLVL_MED_gc;
+   ch->CTRLA = DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_2BYTE_gc;
+}
+
+static void init_dma_engine (void)
+{
+   RGB_TIMER.CTRLA = TC_CLKSEL_OFF_gc;
+   RGB_TIMER.PER = RGB_TIMER_PER;
+   
+   DMA.CTRL = DMA_ENABLE_bm | DMA_DBUFMODE_CH01_gc | DMA_PRIMODE_CH0123_gc;
+   init_dma_ch(&DMA.CH0, dma_buff[0]);
+   init_dma_ch(&DMA.CH1, dma_buff[1]);
+}
+
+static void load_dma_ch (DMA_CH_t * ch, uint16_t * buff)
+{
+   if (dma_leds_to_fill)
+   {
+      uint8_t grb[3];
+      
+      dma_source(dma_led++, grb);
+      ws2812_correct_led(grb);
+      add_to_crc(grb, 3);
+      
+      for (uint8_t byte = 0; byte < 3; byte++)
+      {
+         uint8_t color = grb[byte];
+         
+         for (uint8_t bit = 0; bit < 8; bit++, color <<= 1)
+            *buff++ = (color & 0x80) ? RGB_TIMER_T1H : RGB_TIMER_T0H;
+      }
+      
+      dma_leds_to_fill--;
+      ch->TRFCNT = 24 * 2;
+   }
+   else
+   {
+      /* The channel after the closing one only repeats the zero */
+      buff[0] = 0;
+      ch->TRFCNT = 2;
+      
+      if (dma_closing_ch == 0)
+         dma_closing_ch = ch;
+   }
+}
+
+static void dma_done (void)
+{
+   RGB_TIMER.CTRLA = TC_CLKSEL_OFF_gc;
+   RGB_TIMER.INTCTRLA = 0;
+   RGB_TIMER.INTFLAGS = TC1_OVFIF_bm;
+   
+   if (dma_done_pending)
+   {
+      dma_done_pending = false;
+      ws2812_bus_done_callback();
+   }
+}
+
+/* Call it from the low level only */
+bool ws2812_bus_is_busy (void)
+{
+   if (!dma_busy && dma_done_pending)
+      dma_done();
+   
+   return dma_busy;
+}
+
+/*
+* Returns as soon as the transmission starts. The source is called from the DMA interrupts
+* until ws2812_bus_done_callback() is called.
+*/
+void update_ws2812_bus_from (ws2812_source_t source, uint16_t available_leds_on_bus)
+{
+   while (ws2812_bus_is_busy());
+   
+   frame_crc = 0xFFFF;
+   
+   if (available_leds_on_bus == 0)
+   {
+      ws2812_bus_done_callback();
+      return;
+   }
+   
+   dma_busy = true;
+   dma_source = source;
+   dma_led = 0;
+   dma_leds_to_fill = available_leds_on_bus;
+   dma_closing_ch = 0;
+   
+   load_dma_ch(&DMA.CH0, dma_buff[0]);
+   load_dma_ch(&DMA.CH1, dma_buff[1]);
+   DMA.CH0.CTRLA |= DMA_CH_ENABLE_bm;
+   
+   /* The first periods are low until the DMA reaches CCB */
+   RGB_TIMER.CNT = 0;
+   RGB_TIMER.CCB = 0;
+   RGB_TIMER.CTRLB = TC1_CCBEN_bm | TC_WGMODE_SS_gc;
+   RGB_TIMER.INTFLAGS = TC1_OVFIF_bm;
+   RGB_TIMER.CTRLA = TC_CLKSEL_DIV1_gc;
+}
+
+static void dma_ch_done (DMA_CH_t * ch, uint16_t * buff)
+{
+   ch->CTRLB |= DMA_CH_TRNIF_bm;
+   
+   if (dma_closing_ch == ch)
+   {
+      /* The hardware just enabled the other channel */
+      DMA_CH_t * other = (ch == &DMA.CH0) ? &DMA.CH1 : &DMA.CH0;
+      other->CTRLA &= ~DMA_CH_ENABLE_bm;
+      
+      /* The closing zero is on CCBBUF, wait until the UPDATE moves it to CCB */
+      RGB_TIMER.INTFLAGS = TC1_OVFIF_bm;
+      while (!(RGB_TIMER.INTFLAGS & TC1_OVFIF_bm));
+      
+      RGB_TIMER.CTRLB = 0;
+      
+      /* The timer keeps running until its overflow reports the end on the low level */
+      dma_done_pending = true;
+      dma_busy = false;
+      RGB_TIMER.INTFLAGS = TC1_OVFIF_bm;
+      RGB_TIMER.INTCTRLA = TC_OVFINTLVL_LO_gc;
+   }
+   else
+   {
+      load_dma_ch(ch, buff);
+   }
+}
+
+ISR(DMA_CH0_vect)
+{
+   dma_ch_done(&DMA.CH0, dma_buff[0]);
+}
+
+ISR(DMA_CH1_vect)
+{
+   dma_ch_done(&DMA.CH1, dma_buff[1]);
+}
+
+ISR(TCC1_OVF_vect)
+{
+   dma_done();
+}
+
+#endif
+
+#ifdef RGB_USE_PARALLEL_OUTPUT
+
+/*
+* Sends the 24 bit planes of one LED index.
+* Each bit takes 40 clock cycles (1,25 us). The strips on the mask go high, the ones
+* sending a 0 go low after 13 cycles (406 ns) and the ones sending a 1 after 26 cycles (812 ns).
+*/
+static void xmit_planes (uint8_t * planes, uint8_t mask)
+{
+   asm volatile (
+      "ldi    r19, 24             \n"
+      
+      "1:                         \n"
+      "out    %[vport_out], %[mask]    \n"     // Set the strips on the mask
+      "ld     r18, Z+             \n"
+      "and    r18, %[mask]        \n"
+      "nop                        \n"     // 9x nops
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "out    %[vport_out], r18        \n"     // Clear the strips sending a 0
+      "nop                        \n"     // 12x nops
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "out    %[vport_out], __zero_reg__ \n"     // Clear all strips
+      "nop                        \n"     // 10x nops
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "nop                        \n"
+      "dec    r19                 \n"
+      "brne   1b                  \n"
+      : "+z" (planes)
+      : [vport_out] "I" (_SFR_IO_ADDR(RGB_STRIPS_VPORT.OUT)), [mask] "r" (mask)
+      : "r18", "r19"
+   );
+}
+
+static uint8_t strips_mask (uint8_t led, uint8_t * leds_on_strip, uint8_t strips)
+{
+   uint8_t mask = 0;
+   
+   for (uint8_t strip = 0; strip < strips; strip++)
+      if (led < leds_on_strip[strip])
+         mask |= (1 << strip);
+   
+   return mask;
+}
+
+static uint8_t strips_length (uint8_t * leds_on_strip, uint8_t strips)
+{
+   uint8_t length = 0;
+   
+   for (uint8_t strip = 0; strip < strips; strip++)
+      if (leds_on_strip[strip] > length)
+         length = leds_on_strip[strip];
+   
+   return length;
+}
+
+/*
+* The function is expecting the bit planes like uint8_t planes[leds][24], where the
+* first plane of each LED is the MSB of G and the last one is the LSB of B.
+*/
+void update_ws2812_strips (uint8_t * planes, uint8_t * leds_on_strip, uint8_t strips)
+{
+   uint8_t length = strips_length(leds_on_strip, strips);
+   
+   while (ws2812_bus_is_busy());
+   
+   frame_crc = 0xFFFF;
+   for (uint8_t i = 0; i < length; i++)
+      add_to_crc(planes + i*24, 24);
+   
+   for (uint8_t i = 0; i < length; i++)
+   {
+      xmit_planes(planes + i*24, strips_mask(i, leds_on_strip, strips));
+   }
+   
+   ws2812_bus_done_callback();
+}
+
+/*
+* Sends the same LEDs to all strips, asking each one to the source right before it is sent.
+*/
+void update_ws2812_strips_from (ws2812_source_t source, uint8_t * leds_on_strip, uint8_t strips)
+{
+   uint8_t planes[24];
+   uint8_t grb[3];
+   uint8_t length = strips_length(leds_on_strip, strips);
+   
+   while (ws2812_bus_is_busy());
+   
+   frame_crc = 0xFFFF;
+   
+   for (uint8_t i = 0; i < length; i++)
+   {
+      uint8_t * plane = planes;
+      
+      source(i, grb);
+      ws2812_correct_led(grb);
+      
+      for (uint8_t byte = 0; byte < 3; byte++)
+      {
+         uint8_t color = grb[byte];
+         
+         for (uint8_t bit = 0; bit < 8; bit++, color <<= 1)
+            *plane++ = (color & 0x80) ? 0xFF : 0;
+      }
+      
+      add_to_crc(planes, 24);
+      xmit_planes(planes, strips_mask(i, leds_on_strip, strips));
+   }
+   
+   ws2812_bus_done_callback();
+}
+
+/*
+* Writes the [G][R][B] color of one LED of a strip to the bit planes.
+* The bit planes are sent as they are, so the color must be already corrected.
+*/
+void ws2812_strips_set_led (uint8_t * planes, uint8_t strip, uint8_t led, uint8_t * grb)
+{
+   uint8_t * plane = planes + led*24;
+   uint8_t strip_bit = (1 << strip);
+   
+   for (uint8_t byte = 0; byte < 3; byte++)
+   {
+      uint8_t color = grb[byte];
+      
+      for (uint8_t bit = 0; bit < 8; bit++, color <<= 1)
+      {
+         if (color & 0x80)
+            *plane++ |= strip_bit;
+         else
+            *plane++ &= ~strip_bit;
+      }
+   }
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef _WS2812_H_
 #define _WS2812_H_
 #include <avr/io.h>
+#include "cpu.h"
 
 /************************************************************************/
 /* User defines here the digital output                                 */
@@ -10,6 +11,39 @@
 #define RGB_PORT_CLR    PORTC_OUTCLR
 #define RGB_PIN         5
 
+/************************************************************************/
+/* Output engine                                                        */
+/************************************************************************/
+// Uncomment to shift the bus out with TCC1 and the DMA instead of the asm kernel.
+// RGB_PIN (PC5) is the output of the TCC1 compare channel B, so each WS2812 bit
+// becomes one PWM period and the DMA writes its duty cycle to CCBBUF.
+//#define RGB_USE_DMA_ENGINE
+
+#define RGB_TIMER       TCC1
+#define RGB_TIMER_PER   39          // 40 clock cycles = 1,25 us
+#define RGB_TIMER_T0H   13          // 13 clock cycles = 406 ns
+#define RGB_TIMER_T1H   26          // 26 clock cycles = 812 ns
+
+// Time of each LED on the bus, in 1/4 us, with its source, correction and CRC.
+// The asm kernel takes 45 or 51 cycles per bit plus the loop, 1100 to 1250 cycles per LED,
+// and the rest around 150 cycles more. The DMA engine keeps the 1.25 us of each bit.
+#ifdef RGB_USE_DMA_ENGINE
+   #define RGB_QUARTER_US_PER_LED   120     // 30 us
+#else
+   #define RGB_QUARTER_US_PER_LED   166     // 41.5 us
+#endif
+
+/************************************************************************/
+/* Parallel strips                                                      */
+/************************************************************************/
+// Uncomment to be able to drive up to 8 strips, one on each pin of RGB_STRIPS_PORT.
+// The frame is kept as bit planes, 24 bytes per LED index, where the bit N of each
+// byte belongs to the strip N, so all strips are sent with one OUT write per bit.
+//#define RGB_USE_PARALLEL_OUTPUT
+
+#define RGB_STRIPS_PORT     PORTA
+#define RGB_STRIPS_VPORT    VPORT0      // VPORT0 is mapped to PORTA after reset
+#define RGB_MAX_STRIPS      8
 
 /************************************************************************/
 /* Defines and Macros                                                   */
@@ -63,6 +97,13 @@ do                                                  \
     if (color & 0x01) XMIT_ONE; else XMIT_ZERO;     \
 } while (0)
 
+/************************************************************************/
+/* LED source                                                           */
+/************************************************************************/
+// Writes the [G][R][B] color of the LED led to grb.
+// It runs between two LEDs, while the bus is low, so it must be short (a few us).
+typedef void (*ws2812_source_t)(uint16_t led, uint8_t * grb);
+
 /************************************************************************/
 /* Prototypes                                                           */
 /************************************************************************/
@@ -71,5 +112,21 @@ void update_2rgbs (uint8_t * rgb_led0, uint8_t * rgb_led1);
 void update_3rgbs (uint8_t * rgb_led0, uint8_t * rgb_led1, uint8_t * rgb_led2);
 void update_32rgbs (uint8_t * grb_array);
 void update_ws2812_bus (uint8_t * grb_array, uint16_t num_of_leds_on_bus);
+void update_ws2812_bus_from (ws2812_source_t source, uint16_t num_of_leds_on_bus);
+bool ws2812_bus_is_busy (void);
+
+void ws2812_set_brightness (uint8_t value);
+void ws2812_set_gamma (bool enable);
+void ws2812_correct_led (uint8_t * grb);
+uint16_t ws2812_frame_crc (void);
+
+#ifdef RGB_USE_PARALLEL_OUTPUT
+void update_ws2812_strips (uint8_t * planes, uint8_t * leds_on_strip, uint8_t strips);
+void update_ws2812_strips_from (ws2812_source_t source, uint8_t * leds_on_strip, uint8_t strips);
+void ws2812_strips_set_led (uint8_t * planes, uint8_t strip, uint8_t led, uint8_t * grb);
+#endif
+
+/* Implemented by the application, called on the low level after the last bit left the pin */
+void ws2812_bus_done_callback (void);
 
 #endif /* _WS2812_H_ */
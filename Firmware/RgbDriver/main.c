@@ -2,6 +2,8 @@
 #include "cpu.h"
 #include "WS2812S.h"
 #include "uart0.h"
+#include <string.h>
+#include <avr/pgmspace.h>
 
 #define F_CPU 32000000
 #include <util/delay.h>
@@ -12,6 +14,41 @@
 #define EVENT_LOAD_DONE 0xA1
 #define EVENT_LEDS_UPDATED 0xA2
 #define EVENT_LEDS_OFF 0xA3
+#define EVENT_FRAME_STORED 0xA4
+#define EVENT_STORE_FULL 0xA5
+#define EVENT_LINK_INFO 0xA6
+#define EVENT_LINK_ERROR 0xA7
+#define EVENT_LINK_SWITCH 0xA8
+#define EVENT_LINK_HEALTH 0xA9
+#define EVENT_LEDS_UPDATED_CRC 0xAA
+
+#define STORE_CLEAR (1<<0)
+#define STORE_REWIND (1<<1)
+#define STORE_PLAY (1<<2)
+#define STORE_STOP (1<<3)
+
+#define EFFECT_NONE 0
+#define EFFECT_SOLID 1
+#define EFFECT_CHASE 2
+#define EFFECT_FADE 3
+#define EFFECT_RAINBOW 4
+#define EFFECT_BREATHING 5
+
+#define FRAME_GRB 0        // [G][R][B] of each LED, or the bit planes of the strips
+#define FRAME_RUNS 1       // [count][G][R][B] of each run of LEDs with the same color
+#define FRAME_INDEX4 4     // Palette index of each LED, 4 bits
+#define FRAME_INDEX8 8     // Palette index of each LED, 8 bits
+
+#define LINK_VERSION 2
+#define LINK_SPEED_1MBPS 0
+#define LINK_SPEED_2MBPS 1
+#define LINK_SPEED_4MBPS 2
+#define LINK_MAX_SPEED LINK_SPEED_2MBPS   // At 4 Mb/s a byte arrives each 80 cycles, too few for the parser
+
+#define LINK_ERROR_UART 0      // Framing errors and overruns of the UART
+#define LINK_ERROR_TIMEOUT 1   // Commands cut by the 500 us timeout
+#define LINK_ERROR_NOISE 2     // Bytes outside of a command, or of an unknown one
+#define LINK_ERROR_CRC 3       // v2 frames with a bad CRC
 
 /************************************************************************/
 /* Definition of pins handling                                          */
@@ -32,20 +69,159 @@ extern uint8_t rxbuff_uart0[UART0_RXBUFSIZ];
 /************************************************************************/
 /* Global variables                                                     */
 /************************************************************************/
-#define MAX_LEDS 255
-uint8_t grb_on[MAX_LEDS][3];
-uint8_t grb_off[MAX_LEDS][3];
-uint8_t grb_demo[MAX_LEDS][3];
+#define MAX_LEDS 400
+uint8_t grb_frames[2][MAX_LEDS][3];
+uint8_t * grb_front = &grb_frames[0][0][0];  // Last complete frame, shown on UPDATE_LEDS
+uint8_t * grb_back = &grb_frames[1][0][0];   // Frame being received
+uint8_t front_format = FRAME_GRB;             // FRAME_GRB or FRAME_RUNS
+uint8_t back_format = FRAME_GRB;
+uint8_t grb_off[3];                           // Color of all LEDs when off
+
+/*
+* Frame store.
+* The frames are kept as [G][R][B], like grb_front, or as the indexes of the palette,
+* one after the other, so each UPDATE_LEDS shows the next one without any copy.
+* RAM: 2400 bytes of frames, 864 of store and 384 of palettes, leaving ~440 bytes for the rest
+* and the stack.
+*/
+#define FRAME_STORE_SIZE (8 * 32 * 3)              // Eight frames of 32 LEDs
+#define FRAME_STORE_MAX_FRAMES 24
+uint8_t frame_store[FRAME_STORE_SIZE];
+uint16_t store_offset[FRAME_STORE_MAX_FRAMES];
+uint8_t store_leds[FRAME_STORE_MAX_FRAMES];
+uint8_t store_format[FRAME_STORE_MAX_FRAMES];      // FRAME_GRB, FRAME_INDEX4 or FRAME_INDEX8
+uint8_t store_frames = 0;                          // Frames in the store
+uint16_t store_used = 0;                           // Bytes used by the frames
+uint8_t store_next = 0;                            // Frame shown on the next UPDATE_LEDS
+bool store_playing = false;
 
 uint8_t rx_state = 0;
 uint8_t _3rd_byte;
 
-uint8_t num_of_leds_on_bus = MAX_LEDS;
+uint16_t num_of_leds_on_bus = MAX_LEDS;
+uint16_t back_num_of_leds;    // LEDs of the back frame, taken by the commit
+
+uint8_t * rx_frame;        // Frame being received, 0 if it doesn't fit in the store
+bool rx_streaming = false; // The back frame is being loaded by parts
+uint8_t * rx_grb;          // Where the next LED of the frame is written
+uint8_t rx_color;          // Color of the next byte, 0 is R, 1 is G and 2 is B
+uint8_t rx_leds;           // LEDs of the command already received
+uint8_t rx_num_of_leds;    // LEDs of the command being received
+uint8_t rx_led[3];         // [G][R][B] of the LED being received
+uint8_t rx_count;          // LEDs of the run being received
+uint16_t rx_index;         // Index of the LED being received
+
+uint8_t leds_event = 0;
+
+uint8_t * run;                // Run of the LED being sent, from a frame of runs
+uint16_t run_end;             // First LED after it
+
+uint8_t * shown_frame = 0;    // Frame on the LEDs, 0 if they are off
+uint16_t shown_leds;
+uint8_t shown_format;         // FRAME_GRB, FRAME_RUNS, FRAME_INDEX4 or FRAME_INDEX8
+
+/*
+* Palette.
+* The indexed frames carry the index of each LED on the palette, with 8 or 4 bits, instead
+* of its [R][G][B]. The live ones are expanded when received, so they are shown like any
+* other, and the stored ones keep the indexes and are expanded while sent to the bus.
+* The 256 entries would take most of the RAM left, so the index only uses the lower 6 bits.
+*/
+#define PALETTE_SIZE 64
+uint8_t palette[PALETTE_SIZE][3];   // [G][R][B]
+uint8_t palette_back[PALETTE_SIZE][3];   // Entries being received, copied to the palette by the commit
+uint8_t rx_format;                  // Format of the indexed frame being received
+
+/*
+* Effects.
+* They are rendered on each tick of TCD0 directly to the bus, LED by LED,
+* so they don't need a frame and the link keeps working between the ticks.
+* The tick is 10 ms, or longer when the bus needs it (see render_period_us()).
+*/
+uint8_t effect = EFFECT_NONE;
+uint8_t effect_speed;         // Added to the phase every 10 ms
+uint16_t effect_span;         // LEDs lit by the chase, or LEDs of a full rainbow
+uint8_t effect_grb[3];
+uint32_t effect_phase;        // 64 units are one LED of the chase or one step of 256 of the cycles
+bool effect_on_demo_pin;      // Started by 'c', runs while the DEMO_MODE pin is high
+bool effect_rendered;
+
+uint8_t effect_angle;         // Position of the cycle on this tick
+uint16_t effect_head;         // First LED of the chase on this tick
+uint32_t effect_hue_step;     // Hue between two LEDs of the rainbow (8.8), a full turn when the span is 1
+
+/*
+* Crossfade.
+* When fade_duration_ms is not zero, the triggers fade from the LEDs being shown
+* to the new ones, one frame on each overflow of TCD1, paced by render_period_us().
+*/
+uint16_t fade_duration_ms = 0;
+bool fade_running = false;
+uint8_t * fade_from;          // 0 is the off color
+uint16_t fade_from_leds;
+uint8_t fade_from_format;
+uint8_t * fade_to;
+uint16_t fade_to_leds;
+uint8_t fade_to_format;
+uint8_t fade_event;           // Sent with the first frame of the crossfade
+uint32_t fade_duration_us;
+uint32_t fade_elapsed_us;
+uint32_t fade_period_us;      // Time between two frames of the crossfade
+uint8_t fade_level;           // 0 is fade_from and 255 is almost fade_to
+
+#ifdef RGB_USE_PARALLEL_OUTPUT
+   // When more than one strip is used, the frames hold the bit planes of the strips
+   #define MAX_LEDS_ON_STRIP (MAX_LEDS * 3 / 24)
+   uint8_t strips = 1;
+   uint8_t leds_on_strip[RGB_MAX_STRIPS];
+   
+   uint8_t rx_strip;
+   uint8_t rx_strip_led;
+#endif
+uint8_t rx_strips;
+
+/*
+* Link.
+* It starts with the 'r' 'g' commands at 1 Mb/s. After the master switches it to the
+* v2 framing, each command is checked by its CRC before it's committed.
+*/
+#define LINK_SYNC 0x7E
+#define LINK_MAX_PAYLOAD (1 + 255 * 4)            // The 'n' with 255 runs
+
+#define LINK_HUNT 0
+#define LINK_OP 1
+#define LINK_LENGTH_LSB 2
+#define LINK_LENGTH_MSB 3
+#define LINK_CRC 4
+#define LINK_PAYLOAD 5
+
+uint8_t link_version = 1;
+uint8_t link_state = LINK_HUNT;
+uint8_t link_op;
+uint16_t link_length;         // Bytes of the payload still to receive
+uint8_t link_crc;             // CRC of the header
+uint8_t link_check;           // CRC of the bytes received
+bool link_in_frame = false;   // The commits wait for the CRC
+void (*link_pending)(void) = 0;
+uint8_t rx_speed;
+
+/* Errors since the last 'z', each one stops at 255 */
+uint8_t link_health[5] = {EVENT_LINK_HEALTH, 0, 0, 0, 0};
 
 /************************************************************************/
 /* Prototypes                                                           */
 /************************************************************************/
-void demo_mode (void);
+void start_effect (uint8_t new_effect, uint8_t speed, uint16_t span, uint8_t * grb);
+void stop_effect (void);
+void show_leds (uint8_t * frame, uint16_t leds, uint8_t format, uint8_t event);
+void update_bus (uint8_t * frame, uint16_t leds);
+void update_bus_from (ws2812_source_t source, uint16_t leds);
+static void off_source (uint16_t led, uint8_t * grb);
+static void indexed_source (uint16_t led, uint8_t * grb);
+static void runs_source (uint16_t led, uint8_t * grb);
+void change_leds (uint8_t * frame, uint16_t leds, uint8_t format, uint8_t event);
+void finish_fade (void);
+static void rcv_command_byte (uint8_t byte);
 
 /************************************************************************/
 /* main()                                                               */
@@ -77,15 +253,24 @@ int main(void)
    for (uint16_t i = 0; i < MAX_LEDS; i++)
       for (uint8_t j = 0; j < 3; j++)
       {
-         grb_on[i][j] = 0;
-         grb_off[i][j] = 0;
+         grb_frames[0][i][j] = 0;
+         grb_frames[1][i][j] = 0;
       }
    
+   grb_off[0] = 0;
+   grb_off[1] = 0;
+   grb_off[2] = 0;
+   
+   /* The DMA engine refills its buffers on the medium level */
+   #ifdef RGB_USE_DMA_ENGINE
+      cpu_enable_int_level(INT_LEVEL_MED);
+   #endif
+   
    /* Turn LEDs off */
    //update_32rgbs(&grb_off[0][0]);
-   update_ws2812_bus(&grb_off[0][0], num_of_leds_on_bus);
+   update_bus_from(off_source, num_of_leds_on_bus);
    
-   /* Enable interrupts */
+   /* Enable interrupts, only now since the low level ISRs are naked */
    cpu_enable_int_level(INT_LEVEL_LOW);
    
    /* Do nothing */
@@ -103,241 +288,1874 @@ int main(void)
 // Protocol:
 // RGB array:       'r' 'g' 'b' num_of_leds_on_bus array [num_of_leds_on_bus * 3]
 // RGB demo:        'r' 'g' 'c' num_of_leds_on_bus
+// RGB effect:      'r' 'g' 'e' effect speed span red green blue
 // RGB off values:  'r' 'g' 'd' num_of_leds_on_bus red green blue
+// RGB strips:      'r' 'g' 'p' strips leds_on_strip [strips]
+// RGB window:      'r' 'g' 'w' first_led num_of_leds array [num_of_leds * 3]
+// RGB scatter:     'r' 'g' 'x' num_of_leds {index red green blue} [num_of_leds]
+// Store frame:     'r' 'g' 'q' num_of_leds array [num_of_leds * 3]
+// Store control:   'r' 'g' 'k' command
+// Brightness:      'r' 'g' 'i' brightness
+// Gamma:           'r' 'g' 'y' enable
+// Fade duration:   'r' 'g' 'f' duration_ms_lsb duration_ms_msb
+// Stream part:     'r' 'g' 's' first_led_lsb first_led_msb num_of_leds array [num_of_leds * 3]
+// Stream commit:   'r' 'g' 'l' num_of_leds_on_bus_lsb num_of_leds_on_bus_msb
+// Link info:       'r' 'g' 'v'
+// Link speed:      'r' 'g' 'u' speed
+// Link health:     'r' 'g' 'z'
+// Palette:         'r' 'g' 'a' first_entry num_of_entries array [num_of_entries * 3]
+// Indexed frame:   'r' 'g' 'o' bits num_of_leds indexes [num_of_leds * bits / 8]
+// Store indexed:   'r' 'g' 'h' bits num_of_leds indexes [num_of_leds * bits / 8]
+// RGB runs:        'r' 'g' 'n' num_of_runs {count red green blue} [num_of_runs]
+//
+// The frames with more than 255 LEDs are loaded by parts with 's' and shown after the 'l'.
+// A num_of_leds_on_bus of 0 on 'c' and 'd' keeps the length of the last frame.
+// The indexes have 8 bits, or 4 bits if bits is 4, with the first LED on the high nibble.
+// A new palette is used by the next frames received and by the stored frames.
+// The runs are kept as they arrive and expanded while sent, so a frame of a few colors only
+// takes 4 bytes for each run. The frame has the LEDs of all runs.
+//
+// Link v2:         sync op length_lsb length_msb crc payload [length]
+//
+// The op is the 3rd byte of the commands above and the payload is the rest of the command.
+// The crc is the CRC-8 (0x07) of op, length and payload. The 'v' replies with EVENT_LINK_INFO,
+// version, max speed and the time of each LED on the bus in 1/4 us. The 'u' replies with EVENT_LINK_SWITCH and switches to the v2 framing
+// at the speed, 0 is 1 Mb/s, 1 is 2 Mb/s and 2 is 4 Mb/s. Without a good frame in 100 ms, the
+// link goes back to the 'r' 'g' commands at 1 Mb/s, so the master keeps it alive with the 'z'.
+// The 'z' replies with EVENT_LINK_HEALTH and the UART errors, timeouts, noise bytes and CRC
+// errors since the last one, and clears them.
+//
+// The LEDs updated by the UPDATE_LEDS are reported with EVENT_LEDS_UPDATED_CRC crc_lsb crc_msb, the
+// CRC-16 of the bytes sent to the LEDs, instead of the EVENT_LEDS_UPDATED of the older slaves.
 
-void uart0_rcv_byte_callback(uint8_t byte)
+static const uint8_t rgb_to_grb[3] = {1, 0, 2};
+
+static void count_link_error (uint8_t error)
 {
-   switch (rx_state)
+   if (link_health[1 + error] < 255)
+      link_health[1 + error]++;
+}
+
+/*
+* On the v2 link the commits wait for the CRC of the frame. Returns true if it was deferred.
+*/
+static bool link_defer (void (*commit)(void))
+{
+   if (!link_in_frame)
+      return false;
+   
+   link_pending = commit;
+   return true;
+}
+
+/*
+* The new frame becomes the front buffer and the old one is reused for the next frame.
+*/
+static void commit_frame (void)
+{
+   if (link_defer(commit_frame))
+      return;
+   
+   uint8_t * grb = grb_front;
+   grb_front = grb_back;
+   grb_back = grb;
+   front_format = back_format;
+   num_of_leds_on_bus = back_num_of_leds;
+   
+   rx_streaming = false;
+   
+   uart0_xmit_now_byte(EVENT_LOAD_DONE);
+}
+
+/*
+* The bus may still be sending the buffer that is about to be filled.
+*/
+static void wait_for_back_frame (void)
+{
+   /* The crossfade may be reading the frame, so it jumps to the end */
+   if (fade_running)
+      finish_fade();
+   
+   if (ws2812_bus_is_busy())
    {
-      case 0:
-            if (byte == 'r')
-            {               
-               uart0_rx_pointer = 0;
-               
-               rx_state++;
-               START_TIMEOUT; 
-            }
-            break;
-      case 1:
-            if (byte == 'g')
-            {
-               rx_state++;
-               START_TIMEOUT;
-            }
-            else
-            {
-               rx_state = 0;
-               STOP_TIMEOUT;
-            }
-            break;
-      case 2:
-            if (byte == 'b' || byte == 'c' || byte == 'd')
-            {
-               rx_state++;
-               _3rd_byte = byte;
-               RESET_TIMEOUT;
-            }
-            else
-            {
-               rx_state = 0;
-               STOP_TIMEOUT;
-            }
-            break;
+      disable_uart0_rx;
+      while (ws2812_bus_is_busy());
+      enable_uart0_rx;
+   }
+}
+
+/*
+* Writes the LEDs of the runs as [G][R][B].
+*/
+static void expand_runs (uint8_t * grb, uint8_t * runs, uint16_t leds)
+{
+   while (leds)
+   {
+      uint8_t count = (runs[0] < leds) ? runs[0] : leds;
       
-      case 3:
-            num_of_leds_on_bus = byte;          
-            
-            if (_3rd_byte == 'c')
-            {
-               STOP_TIMEOUT;
-               rx_state = 0;
-               
-               disable_uart0_rx;
-               demo_mode();
-               enable_uart0_rx;
-            }
-            else
-            {  
-               rx_state++;
-               RESET_TIMEOUT;
-            }
-            
-            break;
+      for (leds -= count; count; count--, grb += 3)
+      {
+         grb[0] = runs[1];
+         grb[1] = runs[2];
+         grb[2] = runs[3];
+      }
       
-      case 4:
-            if (_3rd_byte == 'b')
-            {
-               rxbuff_uart0[uart0_rx_pointer++] = byte;
-               RESET_TIMEOUT;
-            
-               if (uart0_rx_pointer == num_of_leds_on_bus * 3 /*+ 1*/)
-               {  
-                  STOP_TIMEOUT;
-                  rx_state = 0;
-               
-                  uart0_xmit_now_byte(EVENT_LOAD_DONE);
-                  
-                  for (uint16_t i = 0; i < num_of_leds_on_bus; i++)
-                  {
-                     *((&grb_on[0][0]) + i*3 + 0) = rxbuff_uart0[i*3 + 1];
-                     *((&grb_on[0][0]) + i*3 + 1) = rxbuff_uart0[i*3 + 0];
-                     *((&grb_on[0][0]) + i*3 + 2) = rxbuff_uart0[i*3 + 2];
-                  }
-               }
-            }
-            if (_3rd_byte == 'd')
-            {
-               rxbuff_uart0[uart0_rx_pointer++] = byte;
-               RESET_TIMEOUT;
-            
-               if (uart0_rx_pointer == 3)
-               {
-                  STOP_TIMEOUT;
-                  rx_state = 0;
-               
-                  for (uint16_t i = 0; i < num_of_leds_on_bus; i++)
-                  {
-                     *((&grb_off[0][0]) + i*3 + 0) = rxbuff_uart0[1];
-                     *((&grb_off[0][0]) + i*3 + 1) = rxbuff_uart0[0];
-                     *((&grb_off[0][0]) + i*3 + 2) = rxbuff_uart0[2];
-                  }
-               }
-            }              
+      runs += 4;
    }
 }
 
-/************************************************************************/
-/* UART timeout                                                         */
-/************************************************************************/
-ISR(TCC0_OVF_vect, ISR_NAKED)
+/*
+* A partial update starts from a copy of the frame being shown.
+*/
+static void start_partial_frame (void)
 {
-   STOP_TIMEOUT;
+   wait_for_back_frame();
    
-   uart0_rx_pointer = 0;
-   rx_state = 0;
+   disable_uart0_rx;
+   if (front_format == FRAME_RUNS)
+      expand_runs(grb_back, grb_front, num_of_leds_on_bus);
+   else
+      memcpy(grb_back, grb_front, MAX_LEDS * 3);
+   enable_uart0_rx;
    
-   reti();
+   back_format = FRAME_GRB;
+   back_num_of_leds = num_of_leds_on_bus;
+   rx_leds = 0;
+   rx_color = 0;
 }
 
-/************************************************************************/
-/* UPDATE_LEDS                                                          */
-/************************************************************************/
-ISR(PORTC_INT0_vect, ISR_NAKED)
+/*
+* Bytes used by a frame with a number of LEDs.
+*/
+static uint16_t frame_size (uint8_t leds, uint8_t format)
+{
+   if (format == FRAME_INDEX8)
+      return leds;
+   
+   if (format == FRAME_INDEX4)
+      return (leds + 1) >> 1;
+   
+   #ifdef RGB_USE_PARALLEL_OUTPUT
+   if (strips > 1)
+   {
+      uint8_t length = 0;
+      
+      for (uint8_t strip = 0; strip < strips; strip++)
+         if (leds_on_strip[strip] > length)
+            length = leds_on_strip[strip];
+      
+      return length * 24;
+   }
+   #endif
+   
+   return leds * 3;
+}
+
+/*
+* Returns the place for a new frame at the end of the store, or 0 if it's full.
+*/
+static uint8_t * store_frame_alloc (uint8_t leds, uint8_t format)
 {
-   if (rx_state == 0)
+   if (store_frames == FRAME_STORE_MAX_FRAMES || store_used + frame_size(leds, format) > FRAME_STORE_SIZE)
+      return 0;
+   
+   /* The bus may be showing one of the frames that will be cleared */
+   wait_for_back_frame();
+   
+   #ifdef RGB_USE_PARALLEL_OUTPUT
+   if (strips > 1)
    {
+      /* The bit planes can't be built from the indexes while they are sent */
+      if (format != FRAME_GRB)
+         return 0;
+      
+      /* The LEDs that are not received must be off */
       disable_uart0_rx;
-      update_ws2812_bus(&grb_on[0][0], num_of_leds_on_bus); //update_32rgbs(&grb_on[0][0]);
-      uart0_xmit_now_byte(EVENT_LEDS_UPDATED);
+      memset(frame_store + store_used, 0, frame_size(leds, format));
       enable_uart0_rx;
    }
+   #endif
    
-   reti();
-}   
+   return frame_store + store_used;
+}
 
-/************************************************************************/
-/* DISABLE_LEDS                                                         */
-/************************************************************************/
-ISR(PORTC_INT1_vect, ISR_NAKED)
-{   
-   disable_uart0_rx;
-   update_ws2812_bus(&grb_off[0][0], num_of_leds_on_bus); //update_32rgbs(&grb_off[0][0]);
-   uart0_xmit_now_byte(EVENT_LEDS_OFF);
-   enable_uart0_rx;
-         
-   reti();
+/*
+* Adds the frame received to the store.
+*/
+static void store_frame_commit (void)
+{
+   if (link_defer(store_frame_commit))
+      return;
+   
+   if (rx_frame == 0)
+   {
+      uart0_xmit_now_byte(EVENT_STORE_FULL);
+      return;
+   }
+   
+   store_offset[store_frames] = store_used;
+   store_leds[store_frames] = rx_num_of_leds;
+   store_format[store_frames] = rx_format;
+   store_used += frame_size(rx_num_of_leds, rx_format);
+   store_frames++;
+   
+   uart0_xmit_now_byte(EVENT_FRAME_STORED);
 }
 
-/************************************************************************/
-/* Demonstration mode                                                   */
-/************************************************************************/
-//#define FINISH_DEMO do {if (!read_DEMO_MODE) {update_32rgbs(&grb_off[0][0]); return;} } while(0)
-#define FINISH_DEMO do {if (!read_DEMO_MODE) {update_ws2812_bus(&grb_off[0][0], num_of_leds_on_bus); return;} } while(0)
+static void store_control (uint8_t command)
+{
+   if (command & STORE_CLEAR)
+   {
+      store_frames = 0;
+      store_used = 0;
+      store_next = 0;
+   }
+   
+   if (command & STORE_REWIND)
+      store_next = 0;
+   
+   if (command & STORE_PLAY)
+      store_playing = true;
+   
+   if (command & STORE_STOP)
+      store_playing = false;
+}
+
+/*
+* Sends again the frame on the LEDs with the new brightness and gamma.
+* If it's the back frame it was already replaced and the next update will show the new one.
+*/
+static void refresh_leds (void)
+{
+   /* A running effect gets them on the next tick */
+   if (effect != EFFECT_NONE)
+   {
+      effect_rendered = false;
+      return;
+   }
    
-void demo_mode (void)
+   /* And a crossfade on the next frame */
+   if (fade_running)
+      return;
+   
+   if (shown_frame != grb_back)
+      show_leds(shown_frame, shown_leds, shown_format, 0);
+}
+
+/*
+* Writes rx_led to the LED of the back frame with the index.
+*/
+static void set_back_led (uint16_t index)
 {
-   while(1)
+   #ifdef RGB_USE_PARALLEL_OUTPUT
+   if (strips > 1)
    {
-      FINISH_DEMO;
-        
-      for (uint8_t jj = 0; jj < 4; jj++)
+      ws2812_correct_led(rx_led);
+      
+      for (uint8_t strip = 0; strip < strips; strip++)
       {
-         for (uint16_t ii = 0; ii < num_of_leds_on_bus; ii++)
+         if (index < leds_on_strip[strip])
          {
-            for (uint16_t i = 0; i < num_of_leds_on_bus; i++)
-               for (uint8_t j = 0; j < 3; j++)
-                  grb_demo[i][j] = 0;
-      
-            if (jj != 3)
-            {
-               grb_demo[ii][jj] = 128;
-            }
-            else
-            {
-               grb_demo[ii][0] = 32;
-               grb_demo[ii][1] = 32;
-               grb_demo[ii][2] = 32;
-            }
-         
-            FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus); //update_32rgbs(&grb_on[0][0]);
-            FINISH_DEMO; _delay_ms(50);
+            ws2812_strips_set_led(grb_back, strip, index, rx_led);
+            return;
          }
+         
+         index -= leds_on_strip[strip];
       }
       
-      for (uint16_t i = 0; i < num_of_leds_on_bus; i++) for (uint8_t j = 0; j < 3; j++) grb_demo[i][j] = 64;
-      FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus);
-      FINISH_DEMO; _delay_ms(250);
-      
-      for (uint16_t i = 0; i < num_of_leds_on_bus; i++) for (uint8_t j = 0; j < 3; j++) grb_demo[i][j] = 64;
-      FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus);
-      FINISH_DEMO; _delay_ms(250);
-      
-      for (uint16_t i = 0; i < num_of_leds_on_bus; i++) for (uint8_t j = 0; j < 3; j++) grb_demo[i][j] = 0;
-      FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus);
-      FINISH_DEMO; _delay_ms(250);
-      
-      for (uint16_t i = 0; i < num_of_leds_on_bus; i++) for (uint8_t j = 0; j < 3; j++) grb_demo[i][j] = 64;
-      FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus);
-      FINISH_DEMO; _delay_ms(250);
-      
-      for (uint16_t i = 0; i < num_of_leds_on_bus; i++) for (uint8_t j = 0; j < 3; j++) grb_demo[i][j] = 0;
-      FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus);
-      FINISH_DEMO; _delay_ms(250);
+      return;
+   }
+   #endif
+   
+   uint8_t * grb = grb_back + index*3;
+   grb[0] = rx_led[0];
+   grb[1] = rx_led[1];
+   grb[2] = rx_led[2];
+}
+
+/*
+* Receives the [R][G][B] of the LEDs of a window, from rx_index on.
+* Returns true after the last one.
+*/
+static bool receive_window_byte (uint8_t byte)
+{
+   RESET_TIMEOUT;
+   
+   rx_led[rgb_to_grb[rx_color]] = byte;
+   
+   if (++rx_color == 3)
+   {
+      rx_color = 0;
       
-      for (uint16_t i = 0; i < num_of_leds_on_bus; i++) for (uint8_t j = 0; j < 3; j++) grb_demo[i][j] = 64;
-      FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus);
-      FINISH_DEMO; _delay_ms(250);
+      if (rx_index < MAX_LEDS)
+         set_back_led(rx_index++);
       
-      for (uint16_t i = 0; i < num_of_leds_on_bus; i++) for (uint8_t j = 0; j < 3; j++) grb_demo[i][j] = 0;      
-      FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus);
-      FINISH_DEMO; _delay_ms(250);  
+      if (++rx_leds == rx_num_of_leds)
+      {
+         STOP_TIMEOUT;
+         rx_state = 0;
+         return true;
+      }
+   }
+   
+   return false;
+}
+
+/*
+* Receives the runs as [count][R][G][B] and keeps them as [count][G][R][B] on the back
+* frame, with rx_index LEDs. The bit planes of the strips get the LEDs of the runs instead.
+* Returns true after the last one.
+*/
+static bool receive_run_byte (uint8_t byte)
+{
+   RESET_TIMEOUT;
+   
+   if (rx_color == 0)
+      rx_count = (rx_index + byte > MAX_LEDS) ? MAX_LEDS - rx_index : byte;
+   else
+      rx_led[rgb_to_grb[rx_color - 1]] = byte;
+   
+   if (++rx_color == 4)
+   {
+      rx_color = 0;
       
-      for (uint8_t intensity = 0; intensity < 128; intensity++)
+      #ifdef RGB_USE_PARALLEL_OUTPUT
+      if (strips > 1)
       {
-         for (uint16_t i = 0; i < num_of_leds_on_bus; i++)
-            for (uint8_t j = 0; j < 3; j++)
-            {
-               grb_demo[i][j] = intensity;  
-            }    
-            
-         FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus); //update_32rgbs(&grb_off[0][0]);
-         FINISH_DEMO; _delay_ms(20);
+         /* set_back_led() corrects the color it gets */
+         uint8_t grb[3] = {rx_led[0], rx_led[1], rx_led[2]};
+         
+         for (; rx_count; rx_count--)
+         {
+            memcpy(rx_led, grb, 3);
+            set_back_led(rx_index++);
+         }
+      }
+      else
+      #endif
+      {
+         rx_grb[0] = rx_count;
+         rx_grb[1] = rx_led[0];
+         rx_grb[2] = rx_led[1];
+         rx_grb[3] = rx_led[2];
+         rx_grb += 4;
+         rx_index += rx_count;
       }
       
-      for (uint8_t intensity = 128; intensity != 0; intensity--)
+      if (++rx_leds == rx_num_of_leds)
       {
-         for (uint16_t i = 0; i < num_of_leds_on_bus; i++)
-            for (uint8_t j = 0; j < 3; j++)
-            {
-               grb_demo[i][j] = intensity;  
-            }    
-            
-         FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus); //update_32rgbs(&grb_off[0][0]);
-         FINISH_DEMO; _delay_ms(20);
+         STOP_TIMEOUT;
+         rx_state = 0;
+         return true;
       }
+   }
+   
+   return false;
+}
+
+/*
+* Index of the LED on a frame of 8 or 4 bit indexes.
+*/
+static uint8_t frame_index (uint8_t * frame, uint8_t format, uint16_t led)
+{
+   if (format == FRAME_INDEX8)
+      return frame[led];
+   
+   return (led & 1) ? frame[led >> 1] & 0x0F : frame[led >> 1] >> 4;
+}
+
+static void palette_led (uint8_t index, uint8_t * grb)
+{
+   uint8_t * entry = palette[index & (PALETTE_SIZE - 1)];
+   
+   grb[0] = entry[0];
+   grb[1] = entry[1];
+   grb[2] = entry[2];
+}
+
+/*
+* Receives the [R][G][B] of the palette entries, from rx_index on, to the back palette.
+* Returns true after the last one.
+*/
+static bool receive_palette_byte (uint8_t byte)
+{
+   RESET_TIMEOUT;
+   
+   rx_led[rgb_to_grb[rx_color]] = byte;
+   
+   if (++rx_color == 3)
+   {
+      rx_color = 0;
       
-      for (uint16_t i = 0; i < num_of_leds_on_bus; i++) for (uint8_t j = 0; j < 3; j++) grb_demo[i][j] = 0;   
-      FINISH_DEMO; update_ws2812_bus(&grb_demo[0][0], num_of_leds_on_bus);
-      FINISH_DEMO; _delay_ms(250);
+      if (rx_index < PALETTE_SIZE)
+         memcpy(palette_back[rx_index++], rx_led, 3);
+   
+      if (++rx_leds == rx_num_of_leds)
+      {
+         STOP_TIMEOUT;
+         rx_state = 0;
+         return true;
+      }
+   }
+   
+   return false;
+}
+
+/*
+* Receives the indexes of a frame. The live ones are expanded to the back frame and the
+* stored ones are kept as they arrive. Returns true after the last one.
+*/
+static bool receive_index_byte (uint8_t byte)
+{
+   RESET_TIMEOUT;
+   
+   if (_3rd_byte == 'h')
+   {
+      if (rx_frame)
+         *rx_grb++ = byte;
+   
+      rx_leds += (rx_format == FRAME_INDEX8) ? 1 : 2;
+   }
+   else if (rx_format == FRAME_INDEX8)
+   {
+      palette_led(byte, rx_led);
+      set_back_led(rx_leds++);
    }
-}
\ No newline at end of file
+   else
+   {
+      palette_led(byte >> 4, rx_led);
+      set_back_led(rx_leds++);
+   
+      if (rx_leds < rx_num_of_leds)
+      {
+         palette_led(byte & 0x0F, rx_led);
+         set_back_led(rx_leds++);
+      }
+   }
+   
+   if (rx_leds >= rx_num_of_leds)
+   {
+      STOP_TIMEOUT;
+      rx_state = 0;
+      return true;
+   }
+   
+   return false;
+}
+
+/*
+* The commands below change the state of the slave, so on the v2 link they also wait
+* for the CRC of the frame. Their arguments are kept on rxbuff_uart0 until then.
+*/
+static void send_link_health (void)
+{
+   if (link_defer(send_link_health))
+      return;
+   
+   uart0_xmit_now(link_health, 5);
+   
+   for (uint8_t i = 1; i < 5; i++)
+      link_health[i] = 0;
+}
+
+static void apply_store_control (void)
+{
+   if (link_defer(apply_store_control))
+      return;
+   
+   store_control(rxbuff_uart0[0]);
+}
+
+/* The first entry is on rxbuff_uart0 and rx_index is after the last one */
+static void set_palette (void)
+{
+   if (link_defer(set_palette))
+      return;
+   
+   uint8_t first = rxbuff_uart0[0];
+   
+   while (ws2812_bus_is_busy());
+   
+   if (rx_index > first)
+      memcpy(palette[first], palette_back[first], (rx_index - first) * 3);
+}
+
+static void set_correction (void)
+{
+   if (link_defer(set_correction))
+      return;
+   
+   while (ws2812_bus_is_busy());
+   
+   if (_3rd_byte == 'i')
+      ws2812_set_brightness(rxbuff_uart0[0]);
+   else
+      ws2812_set_gamma(rxbuff_uart0[0] ? true : false);
+   
+   refresh_leds();
+}
+
+static void set_fade_duration (void)
+{
+   if (link_defer(set_fade_duration))
+      return;
+   
+   fade_duration_ms = rxbuff_uart0[0] | (rxbuff_uart0[1] << 8);
+}
+
+/* Zero keeps the length of the last frame, which may be above 255 */
+static void set_length (void)
+{
+   if (rxbuff_uart0[0])
+      num_of_leds_on_bus = rxbuff_uart0[0];
+}
+
+static void start_demo (void)
+{
+   if (link_defer(start_demo))
+      return;
+   
+   set_length();
+   
+   /* The demonstration is a rainbow over the whole bus */
+   start_effect(EFFECT_RAINBOW, 64, num_of_leds_on_bus, grb_off);
+   effect_on_demo_pin = true;
+}
+
+static void set_off_color (void)
+{
+   if (link_defer(set_off_color))
+      return;
+   
+   set_length();
+   
+   grb_off[0] = rxbuff_uart0[2];
+   grb_off[1] = rxbuff_uart0[1];
+   grb_off[2] = rxbuff_uart0[3];
+}
+
+static void set_effect (void)
+{
+   if (link_defer(set_effect))
+      return;
+   
+   if (rxbuff_uart0[0] == EFFECT_NONE || rxbuff_uart0[0] > EFFECT_BREATHING)
+   {
+      stop_effect();
+   }
+   else
+   {
+      rx_led[0] = rxbuff_uart0[4];
+      rx_led[1] = rxbuff_uart0[3];
+      rx_led[2] = rxbuff_uart0[5];
+      
+      start_effect(rxbuff_uart0[0], rxbuff_uart0[1], rxbuff_uart0[2], rx_led);
+      effect_on_demo_pin = false;
+   }
+}
+
+/* The stored frames were made for the old strips, so they are cleared */
+static void set_strips (void)
+{
+   if (link_defer(set_strips))
+      return;
+   
+   #ifdef RGB_USE_PARALLEL_OUTPUT
+      while (ws2812_bus_is_busy());
+      
+      if (rx_strips == 0)
+      {
+         strips = 1;
+         return;
+      }
+      
+      strips = (rx_strips > RGB_MAX_STRIPS) ? RGB_MAX_STRIPS : rx_strips;
+      
+      for (uint8_t strip = 0; strip < strips; strip++)
+      {
+         leds_on_strip[strip] = rxbuff_uart0[strip];
+         
+         if (leds_on_strip[strip] > MAX_LEDS_ON_STRIP)
+            leds_on_strip[strip] = MAX_LEDS_ON_STRIP;
+      }
+      
+      store_control(STORE_CLEAR);
+   #endif
+}
+
+static void link_switch (void);
+
+static const uint8_t link_info[4] = {EVENT_LINK_INFO, LINK_VERSION, LINK_MAX_SPEED, RGB_QUARTER_US_PER_LED};
+
+static void rcv_command_byte (uint8_t byte)
+{
+   switch (rx_state)
+   {
+      case 0:
+            if (byte == 'r')
+            {               
+               uart0_rx_pointer = 0;
+               
+               rx_state++;
+               START_TIMEOUT; 
+            }
+            else
+            {
+               count_link_error(LINK_ERROR_NOISE);
+            }
+            break;
+      case 1:
+            if (byte == 'g')
+            {
+               rx_state++;
+               START_TIMEOUT;
+            }
+            else
+            {
+               rx_state = 0;
+               STOP_TIMEOUT;
+               count_link_error(LINK_ERROR_NOISE);
+            }
+            break;
+      case 2:
+            if (byte == 'v')
+            {
+               rx_state = 0;
+               STOP_TIMEOUT;
+               uart0_xmit_now(link_info, 4);
+               break;
+            }
+            
+            if (byte == 'z')
+            {
+               rx_state = 0;
+               STOP_TIMEOUT;
+               send_link_health();
+               break;
+            }
+            
+            if (byte == 'u' || byte == 'b' || byte == 'c' || byte == 'd' || byte == 'p' || byte == 'w' || byte == 'x' || byte == 'q' || byte == 'k' || byte == 'i' || byte == 'y' || byte == 'e' || byte == 'f' || byte == 's' || byte == 'l' || byte == 'a' || byte == 'o' || byte == 'h' || byte == 'n')
+            {
+               rx_state++;
+               _3rd_byte = byte;
+               RESET_TIMEOUT;
+            }
+            else
+            {
+               rx_state = 0;
+               STOP_TIMEOUT;
+               count_link_error(LINK_ERROR_NOISE);
+            }
+            break;
+      
+      case 3:
+            if (_3rd_byte == 'p')
+            {
+               rx_strips = byte;
+               
+               if (rx_strips == 0)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+                  set_strips();
+               }
+               else
+               {
+                  rx_state++;
+                  RESET_TIMEOUT;
+               }
+               
+               break;
+            }
+            
+            if (_3rd_byte == 'w' || _3rd_byte == 's' || _3rd_byte == 'l' || _3rd_byte == 'a')
+            {
+               rx_index = byte;
+               rx_state++;
+               RESET_TIMEOUT;
+               break;
+            }
+            
+            if (_3rd_byte == 'o' || _3rd_byte == 'h')
+            {
+               rx_format = (byte == 4) ? FRAME_INDEX4 : FRAME_INDEX8;
+               rx_state++;
+               RESET_TIMEOUT;
+               break;
+            }
+            
+            if (_3rd_byte == 'n')
+            {
+               rx_num_of_leds = byte;
+               rx_leds = 0;
+               rx_color = 0;
+               rx_index = 0;
+               
+               wait_for_back_frame();
+               rx_grb = grb_back;
+               back_format = FRAME_RUNS;
+               
+               #ifdef RGB_USE_PARALLEL_OUTPUT
+                  if (strips > 1)
+                     back_format = FRAME_GRB;
+               #endif
+               
+               if (rx_num_of_leds == 0)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+                  back_num_of_leds = 0;
+                  commit_frame();
+               }
+               else
+               {
+                  rx_state++;
+                  RESET_TIMEOUT;
+               }
+               
+               break;
+            }
+            
+            if (_3rd_byte == 'x')
+            {
+               rx_num_of_leds = byte;
+               start_partial_frame();
+               
+               if (rx_num_of_leds == 0)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+                  commit_frame();
+               }
+               else
+               {
+                  rx_state++;
+                  RESET_TIMEOUT;
+               }
+               
+               break;
+            }
+            
+            if (_3rd_byte == 'k')
+            {
+               STOP_TIMEOUT;
+               rx_state = 0;
+               rxbuff_uart0[0] = byte;
+               apply_store_control();
+               break;
+            }
+            
+            if (_3rd_byte == 'u')
+            {
+               STOP_TIMEOUT;
+               rx_state = 0;
+               rx_speed = byte;
+               link_switch();
+               break;
+            }
+            
+            if (_3rd_byte == 'e' || _3rd_byte == 'f')
+            {
+               rxbuff_uart0[0] = byte;
+               uart0_rx_pointer = 1;
+               rx_state++;
+               RESET_TIMEOUT;
+               break;
+            }
+            
+            if (_3rd_byte == 'i' || _3rd_byte == 'y')
+            {
+               STOP_TIMEOUT;
+               rx_state = 0;
+               rxbuff_uart0[0] = byte;
+               set_correction();
+               break;
+            }
+            
+            if (_3rd_byte == 'b' || _3rd_byte == 'q')
+            {
+               rx_num_of_leds = byte;
+               rx_leds = 0;
+               rx_color = 0;
+               rx_format = FRAME_GRB;
+               
+               if (_3rd_byte == 'b')
+               {
+                  wait_for_back_frame();
+                  rx_frame = grb_back;
+                  back_format = FRAME_GRB;
+               }
+               else
+               {
+                  rx_frame = store_frame_alloc(rx_num_of_leds, FRAME_GRB);
+               }
+               
+               /* A frame that doesn't fit is received anyway and dropped */
+               rx_grb = rx_frame ? rx_frame : rx_led;
+               
+               #ifdef RGB_USE_PARALLEL_OUTPUT
+                  rx_strip = 0;
+                  rx_strip_led = 0;
+                  if (strips > 1)
+                     rx_grb = rx_led;
+               #endif
+               
+               if (rx_num_of_leds == 0)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+                  
+                  if (_3rd_byte == 'b')
+                  {
+                     back_num_of_leds = 0;
+                     commit_frame();
+                  }
+                  else
+                  {
+                     store_frame_commit();
+                  }
+               }
+               else
+               {
+                  rx_state++;
+                  RESET_TIMEOUT;
+               }
+               
+               break;
+            }
+            
+            /* The length of 'c' and 'd' is kept with their arguments */
+            rxbuff_uart0[0] = byte;
+            uart0_rx_pointer = 1;
+            
+            if (_3rd_byte == 'c')
+            {
+               STOP_TIMEOUT;
+               rx_state = 0;
+               start_demo();
+            }
+            else
+            {  
+               rx_state++;
+               RESET_TIMEOUT;
+            }
+            
+            break;
+      
+      case 4:
+            if (_3rd_byte == 'b' || _3rd_byte == 'q')
+            {
+               RESET_TIMEOUT;
+               
+               /* The bytes arrive as [R][G][B] and are kept as [G][R][B] */
+               rx_grb[rgb_to_grb[rx_color]] = byte;
+               
+               if (++rx_color == 3)
+               {
+                  rx_color = 0;
+                  
+                  #ifdef RGB_USE_PARALLEL_OUTPUT
+                  if (strips > 1)
+                  {
+                     /* The LEDs fill the strips in order */
+                     while (rx_strip < strips && rx_strip_led >= leds_on_strip[rx_strip])
+                     {
+                        rx_strip++;
+                        rx_strip_led = 0;
+                     }
+                     
+                     if (rx_strip < strips && rx_frame)
+                     {
+                        ws2812_correct_led(rx_led);
+                        ws2812_strips_set_led(rx_frame, rx_strip, rx_strip_led++, rx_led);
+                     }
+                  }
+                  else
+                  #endif
+                  if (rx_frame)
+                     rx_grb += 3;
+                  
+                  if (++rx_leds == rx_num_of_leds)
+                  {
+                     STOP_TIMEOUT;
+                     rx_state = 0;
+                     
+                     if (_3rd_byte == 'b')
+                     {
+                        back_num_of_leds = rx_num_of_leds;
+                        commit_frame();
+                     }
+                     else
+                     {
+                        store_frame_commit();
+                     }
+                  }
+               }
+            }
+            if (_3rd_byte == 'a')
+            {
+               rxbuff_uart0[0] = rx_index;
+               rx_num_of_leds = byte;
+               rx_leds = 0;
+               rx_color = 0;
+               
+               if (rx_num_of_leds == 0)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+               }
+               else
+               {
+                  rx_state++;
+                  RESET_TIMEOUT;
+               }
+            }
+            if (_3rd_byte == 'o' || _3rd_byte == 'h')
+            {
+               rx_num_of_leds = byte;
+               rx_leds = 0;
+               
+               if (_3rd_byte == 'o')
+               {
+                  wait_for_back_frame();
+                  rx_frame = grb_back;
+                  back_format = FRAME_GRB;
+               }
+               else
+               {
+                  rx_frame = store_frame_alloc(rx_num_of_leds, rx_format);
+               }
+               
+               rx_grb = rx_frame;
+               
+               if (rx_num_of_leds == 0)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+                  
+                  if (_3rd_byte == 'o')
+                  {
+                     back_num_of_leds = 0;
+                     commit_frame();
+                  }
+                  else
+                  {
+                     store_frame_commit();
+                  }
+               }
+               else
+               {
+                  rx_state++;
+                  RESET_TIMEOUT;
+               }
+            }
+            if (_3rd_byte == 'n')
+            {
+               if (receive_run_byte(byte))
+               {
+                  back_num_of_leds = rx_index;
+                  commit_frame();
+               }
+            }
+            if (_3rd_byte == 's')
+            {
+               rx_index |= (byte << 8);
+               rx_state++;
+               RESET_TIMEOUT;
+            }
+            if (_3rd_byte == 'l')
+            {
+               STOP_TIMEOUT;
+               rx_state = 0;
+               
+               /* Without parts, the front frame is loaded again with the new length */
+               if (!rx_streaming)
+                  start_partial_frame();
+               
+               rx_index |= (byte << 8);
+               back_num_of_leds = (rx_index > MAX_LEDS) ? MAX_LEDS : rx_index;
+               commit_frame();
+            }
+            if (_3rd_byte == 'w')
+            {
+               rx_num_of_leds = byte;
+               start_partial_frame();
+               
+               if (rx_num_of_leds == 0)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+                  commit_frame();
+               }
+               else
+               {
+                  rx_state++;
+                  RESET_TIMEOUT;
+               }
+            }
+            if (_3rd_byte == 'x')
+            {
+               RESET_TIMEOUT;
+               
+               /* Each LED arrives as [index][R][G][B] */
+               if (rx_color == 0)
+                  rx_index = byte;
+               else
+                  rx_led[rgb_to_grb[rx_color - 1]] = byte;
+               
+               if (++rx_color == 4)
+               {
+                  rx_color = 0;
+                  
+                  if (rx_index < MAX_LEDS)
+                     set_back_led(rx_index);
+                  
+                  if (++rx_leds == rx_num_of_leds)
+                  {
+                     STOP_TIMEOUT;
+                     rx_state = 0;
+                     commit_frame();
+                  }
+               }
+            }
+            if (_3rd_byte == 'd')
+            {
+               rxbuff_uart0[uart0_rx_pointer++] = byte;
+               RESET_TIMEOUT;
+            
+               if (uart0_rx_pointer == 4)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+                  set_off_color();
+               }
+            }
+            if (_3rd_byte == 'e')
+            {
+               rxbuff_uart0[uart0_rx_pointer++] = byte;
+               RESET_TIMEOUT;
+               
+               if (uart0_rx_pointer == 6)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+                  set_effect();
+               }
+            }
+            if (_3rd_byte == 'f')
+            {
+               rxbuff_uart0[1] = byte;
+               STOP_TIMEOUT;
+               rx_state = 0;
+               set_fade_duration();
+            }
+            if (_3rd_byte == 'p')
+            {
+               if (uart0_rx_pointer < RGB_MAX_STRIPS)
+                  rxbuff_uart0[uart0_rx_pointer] = byte;
+               uart0_rx_pointer++;
+               RESET_TIMEOUT;
+               
+               if (uart0_rx_pointer == rx_strips)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+                  set_strips();
+               }
+            }
+            break;
+      
+      case 5:
+            if (_3rd_byte == 'w')
+            {
+               if (receive_window_byte(byte))
+                  commit_frame();
+            }
+            if (_3rd_byte == 'a')
+            {
+               if (receive_palette_byte(byte))
+                  set_palette();
+            }
+            if (_3rd_byte == 'o')
+            {
+               if (receive_index_byte(byte))
+               {
+                  back_num_of_leds = rx_num_of_leds;
+                  commit_frame();
+               }
+            }
+            if (_3rd_byte == 'h')
+            {
+               if (receive_index_byte(byte))
+                  store_frame_commit();
+            }
+            if (_3rd_byte == 's')
+            {
+               rx_num_of_leds = byte;
+               
+               /* The first part starts from a copy of the frame being shown */
+               if (rx_streaming)
+               {
+                  wait_for_back_frame();
+                  rx_leds = 0;
+                  rx_color = 0;
+               }
+               else
+               {
+                  start_partial_frame();
+                  rx_streaming = true;
+               }
+               
+               if (rx_num_of_leds == 0)
+               {
+                  STOP_TIMEOUT;
+                  rx_state = 0;
+               }
+               else
+               {
+                  rx_state++;
+                  RESET_TIMEOUT;
+               }
+            }
+            break;
+      
+      case 6:
+            /* The parts of a stream are only shown after the commit */
+            if (_3rd_byte == 's')
+               receive_window_byte(byte);
+   }
+}
+
+/************************************************************************/
+/* Link                                                                 */
+/************************************************************************/
+static const uint8_t crc8_table[256] PROGMEM = {   // Polynomial 0x07
+   0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+   0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+   0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+   0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+   0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+   0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+   0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+   0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+   0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+   0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+   0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+   0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+   0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+   0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+   0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+   0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
+};
+
+#define crc8(crc, byte) pgm_read_byte(&crc8_table[(crc) ^ (byte)])
+
+#define START_LINK_DEADLINE timer_type0_enable(&TCE0, TIMER_PRESCALER_DIV1024, 3125, INT_LEVEL_LOW) /* 100 ms */
+#define STOP_LINK_DEADLINE timer_type0_stop(&TCE0)
+
+/*
+* BSEL is 0, so 1 Mb/s uses a BSCALE of 1, 2 Mb/s a BSCALE of 0 and 4 Mb/s the double speed.
+*/
+static void set_link_speed (uint8_t speed)
+{
+   UART0_UART.BAUDCTRLA = 0;
+   UART0_UART.BAUDCTRLB = (speed == LINK_SPEED_1MBPS) ? (1 << 4) : 0;
+   
+   if (speed == LINK_SPEED_4MBPS)
+      UART0_UART.CTRLB |= USART_CLK2X_bm;
+   else
+      UART0_UART.CTRLB &= ~USART_CLK2X_bm;
+}
+
+static void link_reset (void)
+{
+   rx_state = 0;
+   link_state = LINK_HUNT;
+   link_in_frame = false;
+   link_pending = 0;
+}
+
+/*
+* The EVENT_LINK_SWITCH leaves at the old speed, then the master probes the new one.
+*/
+static void link_switch (void)
+{
+   if (link_defer(link_switch))
+      return;
+   
+   if (rx_speed > LINK_MAX_SPEED)
+      return;
+   
+   UART0_UART.STATUS = USART_TXCIF_bm;
+   uart0_xmit_now_byte(EVENT_LINK_SWITCH);
+   while (!(UART0_UART.STATUS & USART_TXCIF_bm));
+   
+   set_link_speed(rx_speed);
+   link_version = 2;
+   link_reset();
+   
+   START_LINK_DEADLINE;
+}
+
+static void link_fall_back (void)
+{
+   STOP_LINK_DEADLINE;
+   STOP_TIMEOUT;
+   
+   set_link_speed(LINK_SPEED_1MBPS);
+   link_version = 1;
+   link_reset();
+}
+
+/*
+* A bad frame drops its commit and, since the parts before it can't be trusted, the stream.
+*/
+static void link_end (void)
+{
+   STOP_TIMEOUT;
+   rx_state = 0;
+   link_state = LINK_HUNT;
+   link_in_frame = false;
+   
+   if (link_check != link_crc)
+   {
+      link_pending = 0;
+      rx_streaming = false;
+      count_link_error(LINK_ERROR_CRC);
+      uart0_xmit_now_byte(EVENT_LINK_ERROR);
+      return;
+   }
+   
+   /* Each good frame gives the link another 100 ms */
+   START_LINK_DEADLINE;
+   
+   if (link_pending)
+   {
+      void (*commit)(void) = link_pending;
+      link_pending = 0;
+      commit();
+   }
+}
+
+static void link_rcv_byte (uint8_t byte)
+{
+   switch (link_state)
+   {
+      case LINK_HUNT:
+            if (byte == LINK_SYNC)
+            {
+               link_state = LINK_OP;
+               START_TIMEOUT;
+            }
+            else
+            {
+               count_link_error(LINK_ERROR_NOISE);
+            }
+            break;
+      
+      case LINK_OP:
+            RESET_TIMEOUT;
+            link_op = byte;
+            link_check = crc8(0, byte);
+            link_state = LINK_LENGTH_LSB;
+            break;
+      
+      case LINK_LENGTH_LSB:
+            RESET_TIMEOUT;
+            link_length = byte;
+            link_check = crc8(link_check, byte);
+            link_state = LINK_LENGTH_MSB;
+            break;
+      
+      case LINK_LENGTH_MSB:
+            RESET_TIMEOUT;
+            link_length |= (byte << 8);
+            link_check = crc8(link_check, byte);
+            
+            if (link_length > LINK_MAX_PAYLOAD)
+            {
+               STOP_TIMEOUT;
+               link_state = LINK_HUNT;
+               count_link_error(LINK_ERROR_NOISE);
+            }
+            else
+            {
+               link_state = LINK_CRC;
+            }
+            break;
+      
+      case LINK_CRC:
+            link_crc = byte;
+            link_in_frame = true;
+            link_pending = 0;
+            
+            /* The command starts as if 'r' 'g' were received */
+            uart0_rx_pointer = 0;
+            rx_state = 2;
+            rcv_command_byte(link_op);
+            
+            if (link_length == 0)
+               link_end();
+            else
+               link_state = LINK_PAYLOAD;
+            break;
+      
+      case LINK_PAYLOAD:
+            link_check = crc8(link_check, byte);
+            
+            /* The bytes of an unknown op, or after the end of the command, are skipped */
+            if (rx_state)
+               rcv_command_byte(byte);
+            else
+               START_TIMEOUT;
+            
+            if (--link_length == 0)
+               link_end();
+            break;
+   }
+}
+
+void uart0_rcv_error_callback(void)
+{
+   count_link_error(LINK_ERROR_UART);
+}
+
+void uart0_rcv_byte_callback(uint8_t byte)
+{
+   if (link_version == 2)
+      link_rcv_byte(byte);
+   else
+      rcv_command_byte(byte);
+}
+
+ISR(TCE0_OVF_vect, ISR_NAKED)
+{
+   link_fall_back();
+   reti();
+}
+
+/************************************************************************/
+/* UART timeout                                                         */
+/************************************************************************/
+ISR(TCC0_OVF_vect, ISR_NAKED)
+{
+   STOP_TIMEOUT;
+   count_link_error(LINK_ERROR_TIMEOUT);
+   
+   uart0_rx_pointer = 0;
+   rx_state = 0;
+   link_state = LINK_HUNT;
+   link_in_frame = false;
+   link_pending = 0;
+   
+   reti();
+}
+
+/************************************************************************/
+/* Show LEDs                                                            */
+/************************************************************************/
+/*
+* The event is sent to the master after the last bit is out of the bus.
+* With the asm kernel the reception is stopped during the transmission,
+* with the DMA engine the function returns right away.
+* A null frame turns the LEDs off.
+*/
+static void start_show (uint8_t event)
+{
+   while (ws2812_bus_is_busy());
+   
+   leds_event = event;
+   
+   #ifndef RGB_USE_DMA_ENGINE
+      disable_uart0_rx;
+   #endif
+}
+
+static void end_show (void)
+{
+   #ifndef RGB_USE_DMA_ENGINE
+      /* Don't let a frame being received expire while the bus was busy */
+      if (rx_state || link_state != LINK_HUNT)
+      {
+         RESET_TIMEOUT;
+         timer_type0_reset_flag(&TCC0);
+      }
+      
+      enable_uart0_rx;
+   #endif
+}
+
+void show_leds (uint8_t * frame, uint16_t leds, uint8_t format, uint8_t event)
+{
+   start_show(event);
+   
+   shown_frame = frame;
+   shown_leds = leds;
+   shown_format = format;
+   
+   if (frame == 0)
+      update_bus_from(off_source, leds);
+   else if (format == FRAME_RUNS)
+      update_bus_from(runs_source, leds);
+   else if (format != FRAME_GRB)
+      update_bus_from(indexed_source, leds);
+   else
+      update_bus(frame, leds);
+   
+   end_show();
+}
+
+/*
+* Shows a frame like grb_front, an array uint8_t grb_array[leds][3] or, when the
+* parallel strips are used, the bit planes of the strips.
+*/
+void update_bus (uint8_t * frame, uint16_t leds)
+{
+   #ifdef RGB_USE_PARALLEL_OUTPUT
+   if (strips > 1)
+   {
+      update_ws2812_strips(frame, leds_on_strip, strips);
+      return;
+   }
+   #endif
+   
+   update_ws2812_bus(frame, leds);
+}
+
+/*
+* Shows a number of LEDs from a source.
+* When the parallel strips are used, every strip gets the same LEDs.
+*/
+void update_bus_from (ws2812_source_t source, uint16_t leds)
+{
+   #ifdef RGB_USE_PARALLEL_OUTPUT
+   if (strips > 1)
+   {
+      update_ws2812_strips_from(source, leds_on_strip, strips);
+      return;
+   }
+   #endif
+   
+   update_ws2812_bus_from(source, leds);
+}
+
+static void off_source (uint16_t led, uint8_t * grb)
+{
+   grb[0] = grb_off[0];
+   grb[1] = grb_off[1];
+   grb[2] = grb_off[2];
+}
+
+/*
+* Expands the runs of the frame being shown. The LEDs are asked in order, so each
+* one is on the same run of the last one or on one of the next.
+*/
+static void runs_source (uint16_t led, uint8_t * grb)
+{
+   if (led == 0)
+   {
+      run = shown_frame;
+      run_end = run[0];
+   }
+   
+   while (led >= run_end)
+   {
+      run += 4;
+      run_end += run[0];
+   }
+   
+   grb[0] = run[1];
+   grb[1] = run[2];
+   grb[2] = run[3];
+}
+
+/*
+* Expands the indexed frame being shown.
+*/
+static void indexed_source (uint16_t led, uint8_t * grb)
+{
+   palette_led(frame_index(shown_frame, shown_format, led), grb);
+}
+
+/*
+* The EVENT_LEDS_UPDATED goes as EVENT_LEDS_UPDATED_CRC, followed by the CRC of the bytes sent, LSB first.
+*/
+void ws2812_bus_done_callback (void)
+{
+   if (leds_event == EVENT_LEDS_UPDATED)
+   {
+      uint16_t crc = ws2812_frame_crc();
+      uint8_t event[3] = {EVENT_LEDS_UPDATED_CRC, crc & 0xFF, crc >> 8};
+      
+      uart0_xmit_now(event, 3);
+      leds_event = 0;
+   }
+   else if (leds_event)
+   {
+      uart0_xmit_now_byte(leds_event);
+      leds_event = 0;
+   }
+}
+
+/************************************************************************/
+/* UPDATE_LEDS                                                          */
+/************************************************************************/
+ISR(PORTC_INT0_vect, ISR_NAKED)
+{
+   /* The triggers take the LEDs back from the effects */
+   effect = EFFECT_NONE;
+   
+   /* While playing, each UPDATE_LEDS shows the next frame of the store */
+   if (store_playing && store_frames)
+   {
+      if (store_next >= store_frames)
+         store_next = 0;
+      
+      change_leds(frame_store + store_offset[store_next], store_leds[store_next], store_format[store_next], EVENT_LEDS_UPDATED);
+      store_next++;
+   }
+   else
+   {
+      change_leds(grb_front, num_of_leds_on_bus, front_format, EVENT_LEDS_UPDATED);
+   }
+   
+   reti();
+}   
+
+/************************************************************************/
+/* DISABLE_LEDS                                                         */
+/************************************************************************/
+ISR(PORTC_INT1_vect, ISR_NAKED)
+{   
+   effect = EFFECT_NONE;
+   
+   change_leds(0, num_of_leds_on_bus, 0, EVENT_LEDS_OFF); //update_32rgbs(&grb_off[0][0]);
+         
+   reti();
+}
+
+/************************************************************************/
+/* Render ticks                                                         */
+/************************************************************************/
+#define RENDER_US_PER_FRAME 100  // Reset of the LEDs and the rest of the tick
+
+/*
+* Time between two frames rendered by a tick, for the effects and the crossfade.
+* The asm kernel holds off the reception while it sends the bus, so the period
+* is twice the frame and the link is free at least half of the time.
+* The DMA engine keeps receiving, so it only needs the frame to be done.
+*/
+static uint32_t render_period_us (uint16_t leds)
+{
+   uint32_t frame_us = (((uint32_t)leds * RGB_QUARTER_US_PER_LED) >> 2) + RENDER_US_PER_FRAME;
+   
+   #ifndef RGB_USE_DMA_ENGINE
+      return frame_us << 1;
+   #else
+      return frame_us;
+   #endif
+}
+
+/*
+* A tick doesn't render while a command is being received, since the asm kernel would cut it.
+*/
+static bool link_is_receiving (void)
+{
+   #ifndef RGB_USE_DMA_ENGINE
+      return rx_state || link_state != LINK_HUNT;
+   #else
+      return false;
+   #endif
+}
+
+/************************************************************************/
+/* Effects                                                              */
+/************************************************************************/
+#define EFFECT_TICK_COUNTS 1250  // 10 ms of 8 us
+
+#define START_EFFECT_TICK timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV256, effect_tick_counts(), INT_LEVEL_LOW)
+#define STOP_EFFECT_TICK timer_type0_stop(&TCD0)
+
+/*
+* Counts of 8 us between two ticks of the effect.
+*/
+static uint16_t effect_tick_counts (void)
+{
+   uint32_t counts = render_period_us(num_of_leds_on_bus) >> 3;
+   
+   return (counts > EFFECT_TICK_COUNTS) ? counts : EFFECT_TICK_COUNTS;
+}
+
+void start_effect (uint8_t new_effect, uint8_t speed, uint16_t span, uint8_t * grb)
+{
+   if (fade_running)
+      finish_fade();
+   
+   effect_speed = speed;
+   effect_span = span ? span : 1;
+   effect_grb[0] = grb[0];
+   effect_grb[1] = grb[1];
+   effect_grb[2] = grb[2];
+   effect_phase = 0;
+   effect_rendered = false;
+   effect = new_effect;
+   
+   START_EFFECT_TICK;
+}
+
+/*
+* The LEDs go back to the frame they had before the effect, or to the last frame
+* received if that one was replaced in the meantime.
+*/
+void stop_effect (void)
+{
+   if (effect == EFFECT_NONE)
+      return;
+   
+   effect = EFFECT_NONE;
+   STOP_EFFECT_TICK;
+   
+   if (shown_frame == grb_back)
+      show_leds(grb_front, num_of_leds_on_bus, front_format, 0);
+   else
+      show_leds(shown_frame, shown_leds, shown_format, 0);
+}
+
+static uint8_t triangle (uint8_t angle)
+{
+   return (angle < 128) ? angle << 1 : (255 - angle) << 1;
+}
+
+static void scale_grb (uint8_t * grb, uint8_t level)
+{
+   grb[0] = ((uint16_t)effect_grb[0] * (level + 1)) >> 8;
+   grb[1] = ((uint16_t)effect_grb[1] * (level + 1)) >> 8;
+   grb[2] = ((uint16_t)effect_grb[2] * (level + 1)) >> 8;
+}
+
+static void effect_source (uint16_t led, uint8_t * grb)
+{
+   uint8_t level;
+   uint8_t hue;
+   
+   switch (effect)
+   {
+      case EFFECT_CHASE:
+            /* Distance to the head, going around the bus */
+            if (led < effect_head)
+               led += num_of_leds_on_bus;
+            
+            scale_grb(grb, (led - effect_head < effect_span) ? 255 : 0);
+            break;
+      
+      case EFFECT_FADE:
+            scale_grb(grb, triangle(effect_angle));
+            break;
+      
+      case EFFECT_BREATHING:
+            level = triangle(effect_angle);
+            scale_grb(grb, ((uint16_t)level * level) >> 8);
+            break;
+      
+      case EFFECT_RAINBOW:
+            hue = effect_angle + (uint8_t)(((uint32_t)led * effect_hue_step) >> 8);
+            
+            if (hue < 85)
+            {
+               grb[0] = hue * 3; grb[1] = 255 - hue * 3; grb[2] = 0;
+            }
+            else if (hue < 170)
+            {
+               hue -= 85;
+               grb[0] = 255 - hue * 3; grb[1] = 0; grb[2] = hue * 3;
+            }
+            else
+            {
+               hue -= 170;
+               grb[0] = 0; grb[1] = hue * 3; grb[2] = 255 - hue * 3;
+            }
+            break;
+      
+      default:
+            scale_grb(grb, 255);
+   }
+}
+
+/*
+* Each tick renders the effect at the current phase.
+* The triggers and stop_effect() clear the effect, so a static frame is back within one tick.
+* The phase moves with the length of the tick, so the speed is the same when the tick is longer.
+*/
+static void effect_tick (void)
+{
+   if (effect_on_demo_pin && !read_DEMO_MODE)
+   {
+      effect = EFFECT_NONE;
+      effect_on_demo_pin = false;
+      
+      show_leds(0, num_of_leds_on_bus, 0, 0);
+   }
+   
+   if (effect == EFFECT_NONE)
+   {
+      STOP_EFFECT_TICK;
+      return;
+   }
+   
+   /* The counter has just wrapped, so the period can follow the LEDs on the bus */
+   uint16_t counts = effect_tick_counts();
+   timer_type0_set_target(&TCD0, counts);
+   
+   /* A solid color only needs to be sent once */
+   if ((effect != EFFECT_SOLID || !effect_rendered) && !link_is_receiving())
+   {
+      effect_angle = effect_phase >> 6;
+      effect_head = num_of_leds_on_bus ? (effect_phase >> 6) % num_of_leds_on_bus : 0;
+      effect_hue_step = 0x10000UL / effect_span;
+      
+      start_show(0);
+      update_bus_from(effect_source, num_of_leds_on_bus);
+      end_show();
+      
+      effect_rendered = true;
+   }
+   
+   effect_phase += ((uint32_t)effect_speed * counts) / EFFECT_TICK_COUNTS;
+}
+
+ISR(TCD0_OVF_vect, ISR_NAKED)
+{
+   effect_tick();
+   
+   reti();
+}
+
+/************************************************************************/
+/* Crossfade                                                            */
+/************************************************************************/
+#define STOP_FADE_TICK timer_type1_stop(&TCD1)
+
+/*
+* Shows a frame, or the off color if it's null, right away or with a crossfade.
+* The bit planes of the parallel strips can't be mixed, so they are always shown right away.
+*/
+void change_leds (uint8_t * frame, uint16_t leds, uint8_t format, uint8_t event)
+{
+   if (fade_running)
+      finish_fade();
+   
+   #ifdef RGB_USE_PARALLEL_OUTPUT
+   if (strips > 1)
+   {
+      show_leds(frame, leds, format, event);
+      return;
+   }
+   #endif
+   
+   if (fade_duration_ms == 0)
+   {
+      show_leds(frame, leds, format, event);
+      return;
+   }
+   
+   fade_from = shown_frame;
+   fade_from_leds = shown_leds;
+   fade_from_format = shown_format;
+   fade_to = frame;
+   fade_to_leds = leds;
+   fade_to_format = format;
+   fade_event = event;
+   
+   fade_duration_us = (uint32_t)fade_duration_ms * 1000;
+   fade_elapsed_us = 0;
+   fade_period_us = render_period_us((leds > fade_from_leds) ? leds : fade_from_leds);
+   fade_running = true;
+   
+   /* 2 us per count */
+   timer_type1_enable(&TCD1, TIMER_PRESCALER_DIV64, fade_period_us >> 1, INT_LEVEL_LOW);
+}
+
+/*
+* Shows the last frame of the crossfade.
+*/
+void finish_fade (void)
+{
+   STOP_FADE_TICK;
+   fade_running = false;
+   
+   show_leds(fade_to, fade_to_leds, fade_to_format, fade_event);
+   fade_event = 0;
+}
+
+static void frame_led (uint8_t * frame, uint16_t leds, uint8_t format, uint16_t led, uint8_t * grb)
+{
+   if (frame == 0 || led >= leds)
+   {
+      off_source(led, grb);
+   }
+   else if (format == FRAME_RUNS)
+   {
+      /* The LEDs of the runs add up to leds */
+      while (led >= frame[0])
+      {
+         led -= frame[0];
+         frame += 4;
+      }
+      
+      grb[0] = frame[1];
+      grb[1] = frame[2];
+      grb[2] = frame[3];
+   }
+   else if (format != FRAME_GRB)
+   {
+      palette_led(frame_index(frame, format, led), grb);
+   }
+   else
+   {
+      grb[0] = frame[led*3 + 0];
+      grb[1] = frame[led*3 + 1];
+      grb[2] = frame[led*3 + 2];
+   }
+}
+
+static void fade_source (uint16_t led, uint8_t * grb)
+{
+   uint8_t from[3];
+   
+   frame_led(fade_from, fade_from_leds, fade_from_format, led, from);
+   frame_led(fade_to, fade_to_leds, fade_to_format, led, grb);
+   
+   for (uint8_t byte = 0; byte < 3; byte++)
+      grb[byte] = ((uint16_t)grb[byte] * fade_level + (uint16_t)from[byte] * (256 - fade_level)) >> 8;
+}
+
+static void fade_tick (void)
+{
+   fade_elapsed_us += fade_period_us;
+   
+   if (fade_elapsed_us >= fade_duration_us)
+   {
+      finish_fade();
+      return;
+   }
+   
+   uint16_t level = fade_elapsed_us / (fade_duration_us >> 8);
+   fade_level = (level > 255) ? 255 : level;
+   
+   /* The next step catches up with the time */
+   if (link_is_receiving())
+      return;
+   
+   start_show(fade_event);
+   update_bus_from(fade_source, (fade_to_leds > fade_from_leds) ? fade_to_leds : fade_from_leds);
+   end_show();
+   
+   fade_event = 0;
+}
+
+ISR(TCD1_OVF_vect, ISR_NAKED)
+{
+   fade_tick();
+   
+   reti();
+}
@@ -186,6 +186,10 @@ extern uint8_t rx[];
 
 UART0_RX_ROUTINE_
 {
+	/* The errors are the ones of the byte on DATA, so they are read before it */
+	if (UART0_UART.STATUS & (USART_FERR_bm | USART_BUFOVF_bm))
+		uart0_rcv_error_callback();
+	
 	//disable_uart0_rx;
 	uart0_rcv_byte_callback(UART0_DATA);
 	//enable_uart0_rx;
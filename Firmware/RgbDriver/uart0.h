@@ -11,7 +11,7 @@
 #define UART0_TX_INT_LEVEL		INT_LEVEL_LOW
 #define UART0_CTS_INT_LEVEL	    INT_LEVEL_LOW
 
-#define UART0_RXBUFSIZ			1024
+#define UART0_RXBUFSIZ			16
 #define UART0_TXBUFSIZ			32
 
 #define UART0_UART				USARTD0
@@ -50,6 +50,7 @@ void uart0_xmit_now_byte(const uint8_t byte);
 void uart0_xmit(const uint8_t *dataIn0, uint8_t siz);
 
 void uart0_rcv_byte_callback(uint8_t byte);
+void uart0_rcv_error_callback(void);
 bool uart0_rcv_now(uint8_t * byte);
 
 #endif /* _UART0_H_ */
@@ -56,7 +56,44 @@ namespace Harp.RgbArray
             { 48, typeof(OutputState) },
             { 49, typeof(DigitalOutputPulsePeriod) },
             { 50, typeof(DigitalOutputPulseCount) },
-            { 51, typeof(EventEnable) }
+            { 51, typeof(EventEnable) },
+            { 52, typeof(StripLedCount) },
+            { 53, typeof(RgbWindow) },
+            { 54, typeof(RgbScatter) },
+            { 55, typeof(SequenceFrame) },
+            { 56, typeof(SequenceControl) },
+            { 57, typeof(SequenceLength) },
+            { 58, typeof(Brightness) },
+            { 59, typeof(GammaCorrection) },
+            { 60, typeof(Effect) },
+            { 61, typeof(FadeDuration) },
+            { 62, typeof(ExtendedLedCount) },
+            { 63, typeof(RgbPage) },
+            { 64, typeof(CoalescedFrames) },
+            { 65, typeof(IndependentBuses) },
+            { 66, typeof(PresentationTime) },
+            { 67, typeof(ScheduledRgbState) },
+            { 68, typeof(FrameRing) },
+            { 69, typeof(FrameRingCount) },
+            { 70, typeof(FrameRingHead) },
+            { 71, typeof(FrameRingTail) },
+            { 72, typeof(PulseOnTime) },
+            { 73, typeof(PulseOffTime) },
+            { 74, typeof(DisplayTime) },
+            { 75, typeof(LatencyStats) },
+            { 76, typeof(LatencyHistogram) },
+            { 77, typeof(FrameCounters) },
+            { 78, typeof(LoadTimeouts) },
+            { 79, typeof(LatchSkew) },
+            { 80, typeof(LinkSpeed) },
+            { 81, typeof(LinkStatus) },
+            { 82, typeof(Palette) },
+            { 83, typeof(PaletteFrame) },
+            { 84, typeof(SequencePaletteFrame) },
+            { 85, typeof(FrameCrc) },
+            { 86, typeof(LinkErrors) },
+            { 87, typeof(LinkResyncs) },
+            { 88, typeof(UpdateLatency) }
         };
 
         /// <summary>
@@ -138,6 +175,43 @@ namespace Harp.RgbArray
     /// <seealso cref="DigitalOutputPulsePeriod"/>
     /// <seealso cref="DigitalOutputPulseCount"/>
     /// <seealso cref="EventEnable"/>
+    /// <seealso cref="StripLedCount"/>
+    /// <seealso cref="RgbWindow"/>
+    /// <seealso cref="RgbScatter"/>
+    /// <seealso cref="SequenceFrame"/>
+    /// <seealso cref="SequenceControl"/>
+    /// <seealso cref="SequenceLength"/>
+    /// <seealso cref="Brightness"/>
+    /// <seealso cref="GammaCorrection"/>
+    /// <seealso cref="Effect"/>
+    /// <seealso cref="FadeDuration"/>
+    /// <seealso cref="ExtendedLedCount"/>
+    /// <seealso cref="RgbPage"/>
+    /// <seealso cref="CoalescedFrames"/>
+    /// <seealso cref="IndependentBuses"/>
+    /// <seealso cref="PresentationTime"/>
+    /// <seealso cref="ScheduledRgbState"/>
+    /// <seealso cref="FrameRing"/>
+    /// <seealso cref="FrameRingCount"/>
+    /// <seealso cref="FrameRingHead"/>
+    /// <seealso cref="FrameRingTail"/>
+    /// <seealso cref="PulseOnTime"/>
+    /// <seealso cref="PulseOffTime"/>
+    /// <seealso cref="DisplayTime"/>
+    /// <seealso cref="LatencyStats"/>
+    /// <seealso cref="LatencyHistogram"/>
+    /// <seealso cref="FrameCounters"/>
+    /// <seealso cref="LoadTimeouts"/>
+    /// <seealso cref="LatchSkew"/>
+    /// <seealso cref="LinkSpeed"/>
+    /// <seealso cref="LinkStatus"/>
+    /// <seealso cref="Palette"/>
+    /// <seealso cref="PaletteFrame"/>
+    /// <seealso cref="SequencePaletteFrame"/>
+    /// <seealso cref="FrameCrc"/>
+    /// <seealso cref="LinkErrors"/>
+    /// <seealso cref="LinkResyncs"/>
+    /// <seealso cref="UpdateLatency"/>
     [XmlInclude(typeof(LedStatus))]
     [XmlInclude(typeof(LedCount))]
     [XmlInclude(typeof(RgbState))]
@@ -156,6 +230,43 @@ namespace Harp.RgbArray
     [XmlInclude(typeof(DigitalOutputPulsePeriod))]
     [XmlInclude(typeof(DigitalOutputPulseCount))]
     [XmlInclude(typeof(EventEnable))]
+    [XmlInclude(typeof(StripLedCount))]
+    [XmlInclude(typeof(RgbWindow))]
+    [XmlInclude(typeof(RgbScatter))]
+    [XmlInclude(typeof(SequenceFrame))]
+    [XmlInclude(typeof(SequenceControl))]
+    [XmlInclude(typeof(SequenceLength))]
+    [XmlInclude(typeof(Brightness))]
+    [XmlInclude(typeof(GammaCorrection))]
+    [XmlInclude(typeof(Effect))]
+    [XmlInclude(typeof(FadeDuration))]
+    [XmlInclude(typeof(ExtendedLedCount))]
+    [XmlInclude(typeof(RgbPage))]
+    [XmlInclude(typeof(CoalescedFrames))]
+    [XmlInclude(typeof(IndependentBuses))]
+    [XmlInclude(typeof(PresentationTime))]
+    [XmlInclude(typeof(ScheduledRgbState))]
+    [XmlInclude(typeof(FrameRing))]
+    [XmlInclude(typeof(FrameRingCount))]
+    [XmlInclude(typeof(FrameRingHead))]
+    [XmlInclude(typeof(FrameRingTail))]
+    [XmlInclude(typeof(PulseOnTime))]
+    [XmlInclude(typeof(PulseOffTime))]
+    [XmlInclude(typeof(DisplayTime))]
+    [XmlInclude(typeof(LatencyStats))]
+    [XmlInclude(typeof(LatencyHistogram))]
+    [XmlInclude(typeof(FrameCounters))]
+    [XmlInclude(typeof(LoadTimeouts))]
+    [XmlInclude(typeof(LatchSkew))]
+    [XmlInclude(typeof(LinkSpeed))]
+    [XmlInclude(typeof(LinkStatus))]
+    [XmlInclude(typeof(Palette))]
+    [XmlInclude(typeof(PaletteFrame))]
+    [XmlInclude(typeof(SequencePaletteFrame))]
+    [XmlInclude(typeof(FrameCrc))]
+    [XmlInclude(typeof(LinkErrors))]
+    [XmlInclude(typeof(LinkResyncs))]
+    [XmlInclude(typeof(UpdateLatency))]
     [Description("Filters register-specific messages reported by the RgbArray device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -195,6 +306,43 @@ namespace Harp.RgbArray
     /// <seealso cref="DigitalOutputPulsePeriod"/>
     /// <seealso cref="DigitalOutputPulseCount"/>
     /// <seealso cref="EventEnable"/>
+    /// <seealso cref="StripLedCount"/>
+    /// <seealso cref="RgbWindow"/>
+    /// <seealso cref="RgbScatter"/>
+    /// <seealso cref="SequenceFrame"/>
+    /// <seealso cref="SequenceControl"/>
+    /// <seealso cref="SequenceLength"/>
+    /// <seealso cref="Brightness"/>
+    /// <seealso cref="GammaCorrection"/>
+    /// <seealso cref="Effect"/>
+    /// <seealso cref="FadeDuration"/>
+    /// <seealso cref="ExtendedLedCount"/>
+    /// <seealso cref="RgbPage"/>
+    /// <seealso cref="CoalescedFrames"/>
+    /// <seealso cref="IndependentBuses"/>
+    /// <seealso cref="PresentationTime"/>
+    /// <seealso cref="ScheduledRgbState"/>
+    /// <seealso cref="FrameRing"/>
+    /// <seealso cref="FrameRingCount"/>
+    /// <seealso cref="FrameRingHead"/>
+    /// <seealso cref="FrameRingTail"/>
+    /// <seealso cref="PulseOnTime"/>
+    /// <seealso cref="PulseOffTime"/>
+    /// <seealso cref="DisplayTime"/>
+    /// <seealso cref="LatencyStats"/>
+    /// <seealso cref="LatencyHistogram"/>
+    /// <seealso cref="FrameCounters"/>
+    /// <seealso cref="LoadTimeouts"/>
+    /// <seealso cref="LatchSkew"/>
+    /// <seealso cref="LinkSpeed"/>
+    /// <seealso cref="LinkStatus"/>
+    /// <seealso cref="Palette"/>
+    /// <seealso cref="PaletteFrame"/>
+    /// <seealso cref="SequencePaletteFrame"/>
+    /// <seealso cref="FrameCrc"/>
+    /// <seealso cref="LinkErrors"/>
+    /// <seealso cref="LinkResyncs"/>
+    /// <seealso cref="UpdateLatency"/>
     [XmlInclude(typeof(LedStatus))]
     [XmlInclude(typeof(LedCount))]
     [XmlInclude(typeof(RgbState))]
@@ -213,6 +361,43 @@ namespace Harp.RgbArray
     [XmlInclude(typeof(DigitalOutputPulsePeriod))]
     [XmlInclude(typeof(DigitalOutputPulseCount))]
     [XmlInclude(typeof(EventEnable))]
+    [XmlInclude(typeof(StripLedCount))]
+    [XmlInclude(typeof(RgbWindow))]
+    [XmlInclude(typeof(RgbScatter))]
+    [XmlInclude(typeof(SequenceFrame))]
+    [XmlInclude(typeof(SequenceControl))]
+    [XmlInclude(typeof(SequenceLength))]
+    [XmlInclude(typeof(Brightness))]
+    [XmlInclude(typeof(GammaCorrection))]
+    [XmlInclude(typeof(Effect))]
+    [XmlInclude(typeof(FadeDuration))]
+    [XmlInclude(typeof(ExtendedLedCount))]
+    [XmlInclude(typeof(RgbPage))]
+    [XmlInclude(typeof(CoalescedFrames))]
+    [XmlInclude(typeof(IndependentBuses))]
+    [XmlInclude(typeof(PresentationTime))]
+    [XmlInclude(typeof(ScheduledRgbState))]
+    [XmlInclude(typeof(FrameRing))]
+    [XmlInclude(typeof(FrameRingCount))]
+    [XmlInclude(typeof(FrameRingHead))]
+    [XmlInclude(typeof(FrameRingTail))]
+    [XmlInclude(typeof(PulseOnTime))]
+    [XmlInclude(typeof(PulseOffTime))]
+    [XmlInclude(typeof(DisplayTime))]
+    [XmlInclude(typeof(LatencyStats))]
+    [XmlInclude(typeof(LatencyHistogram))]
+    [XmlInclude(typeof(FrameCounters))]
+    [XmlInclude(typeof(LoadTimeouts))]
+    [XmlInclude(typeof(LatchSkew))]
+    [XmlInclude(typeof(LinkSpeed))]
+    [XmlInclude(typeof(LinkStatus))]
+    [XmlInclude(typeof(Palette))]
+    [XmlInclude(typeof(PaletteFrame))]
+    [XmlInclude(typeof(SequencePaletteFrame))]
+    [XmlInclude(typeof(FrameCrc))]
+    [XmlInclude(typeof(LinkErrors))]
+    [XmlInclude(typeof(LinkResyncs))]
+    [XmlInclude(typeof(UpdateLatency))]
     [XmlInclude(typeof(TimestampedLedStatus))]
     [XmlInclude(typeof(TimestampedLedCount))]
     [XmlInclude(typeof(TimestampedRgbState))]
@@ -231,6 +416,43 @@ namespace Harp.RgbArray
     [XmlInclude(typeof(TimestampedDigitalOutputPulsePeriod))]
     [XmlInclude(typeof(TimestampedDigitalOutputPulseCount))]
     [XmlInclude(typeof(TimestampedEventEnable))]
+    [XmlInclude(typeof(TimestampedStripLedCount))]
+    [XmlInclude(typeof(TimestampedRgbWindow))]
+    [XmlInclude(typeof(TimestampedRgbScatter))]
+    [XmlInclude(typeof(TimestampedSequenceFrame))]
+    [XmlInclude(typeof(TimestampedSequenceControl))]
+    [XmlInclude(typeof(TimestampedSequenceLength))]
+    [XmlInclude(typeof(TimestampedBrightness))]
+    [XmlInclude(typeof(TimestampedGammaCorrection))]
+    [XmlInclude(typeof(TimestampedEffect))]
+    [XmlInclude(typeof(TimestampedFadeDuration))]
+    [XmlInclude(typeof(TimestampedExtendedLedCount))]
+    [XmlInclude(typeof(TimestampedRgbPage))]
+    [XmlInclude(typeof(TimestampedCoalescedFrames))]
+    [XmlInclude(typeof(TimestampedIndependentBuses))]
+    [XmlInclude(typeof(TimestampedPresentationTime))]
+    [XmlInclude(typeof(TimestampedScheduledRgbState))]
+    [XmlInclude(typeof(TimestampedFrameRing))]
+    [XmlInclude(typeof(TimestampedFrameRingCount))]
+    [XmlInclude(typeof(TimestampedFrameRingHead))]
+    [XmlInclude(typeof(TimestampedFrameRingTail))]
+    [XmlInclude(typeof(TimestampedPulseOnTime))]
+    [XmlInclude(typeof(TimestampedPulseOffTime))]
+    [XmlInclude(typeof(TimestampedDisplayTime))]
+    [XmlInclude(typeof(TimestampedLatencyStats))]
+    [XmlInclude(typeof(TimestampedLatencyHistogram))]
+    [XmlInclude(typeof(TimestampedFrameCounters))]
+    [XmlInclude(typeof(TimestampedLoadTimeouts))]
+    [XmlInclude(typeof(TimestampedLatchSkew))]
+    [XmlInclude(typeof(TimestampedLinkSpeed))]
+    [XmlInclude(typeof(TimestampedLinkStatus))]
+    [XmlInclude(typeof(TimestampedPalette))]
+    [XmlInclude(typeof(TimestampedPaletteFrame))]
+    [XmlInclude(typeof(TimestampedSequencePaletteFrame))]
+    [XmlInclude(typeof(TimestampedFrameCrc))]
+    [XmlInclude(typeof(TimestampedLinkErrors))]
+    [XmlInclude(typeof(TimestampedLinkResyncs))]
+    [XmlInclude(typeof(TimestampedUpdateLatency))]
     [Description("Filters and selects specific messages reported by the RgbArray device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -267,6 +489,43 @@ namespace Harp.RgbArray
     /// <seealso cref="DigitalOutputPulsePeriod"/>
     /// <seealso cref="DigitalOutputPulseCount"/>
     /// <seealso cref="EventEnable"/>
+    /// <seealso cref="StripLedCount"/>
+    /// <seealso cref="RgbWindow"/>
+    /// <seealso cref="RgbScatter"/>
+    /// <seealso cref="SequenceFrame"/>
+    /// <seealso cref="SequenceControl"/>
+    /// <seealso cref="SequenceLength"/>
+    /// <seealso cref="Brightness"/>
+    /// <seealso cref="GammaCorrection"/>
+    /// <seealso cref="Effect"/>
+    /// <seealso cref="FadeDuration"/>
+    /// <seealso cref="ExtendedLedCount"/>
+    /// <seealso cref="RgbPage"/>
+    /// <seealso cref="CoalescedFrames"/>
+    /// <seealso cref="IndependentBuses"/>
+    /// <seealso cref="PresentationTime"/>
+    /// <seealso cref="ScheduledRgbState"/>
+    /// <seealso cref="FrameRing"/>
+    /// <seealso cref="FrameRingCount"/>
+    /// <seealso cref="FrameRingHead"/>
+    /// <seealso cref="FrameRingTail"/>
+    /// <seealso cref="PulseOnTime"/>
+    /// <seealso cref="PulseOffTime"/>
+    /// <seealso cref="DisplayTime"/>
+    /// <seealso cref="LatencyStats"/>
+    /// <seealso cref="LatencyHistogram"/>
+    /// <seealso cref="FrameCounters"/>
+    /// <seealso cref="LoadTimeouts"/>
+    /// <seealso cref="LatchSkew"/>
+    /// <seealso cref="LinkSpeed"/>
+    /// <seealso cref="LinkStatus"/>
+    /// <seealso cref="Palette"/>
+    /// <seealso cref="PaletteFrame"/>
+    /// <seealso cref="SequencePaletteFrame"/>
+    /// <seealso cref="FrameCrc"/>
+    /// <seealso cref="LinkErrors"/>
+    /// <seealso cref="LinkResyncs"/>
+    /// <seealso cref="UpdateLatency"/>
     [XmlInclude(typeof(LedStatus))]
     [XmlInclude(typeof(LedCount))]
     [XmlInclude(typeof(RgbState))]
@@ -285,6 +544,43 @@ namespace Harp.RgbArray
     [XmlInclude(typeof(DigitalOutputPulsePeriod))]
     [XmlInclude(typeof(DigitalOutputPulseCount))]
     [XmlInclude(typeof(EventEnable))]
+    [XmlInclude(typeof(StripLedCount))]
+    [XmlInclude(typeof(RgbWindow))]
+    [XmlInclude(typeof(RgbScatter))]
+    [XmlInclude(typeof(SequenceFrame))]
+    [XmlInclude(typeof(SequenceControl))]
+    [XmlInclude(typeof(SequenceLength))]
+    [XmlInclude(typeof(Brightness))]
+    [XmlInclude(typeof(GammaCorrection))]
+    [XmlInclude(typeof(Effect))]
+    [XmlInclude(typeof(FadeDuration))]
+    [XmlInclude(typeof(ExtendedLedCount))]
+    [XmlInclude(typeof(RgbPage))]
+    [XmlInclude(typeof(CoalescedFrames))]
+    [XmlInclude(typeof(IndependentBuses))]
+    [XmlInclude(typeof(PresentationTime))]
+    [XmlInclude(typeof(ScheduledRgbState))]
+    [XmlInclude(typeof(FrameRing))]
+    [XmlInclude(typeof(FrameRingCount))]
+    [XmlInclude(typeof(FrameRingHead))]
+    [XmlInclude(typeof(FrameRingTail))]
+    [XmlInclude(typeof(PulseOnTime))]
+    [XmlInclude(typeof(PulseOffTime))]
+    [XmlInclude(typeof(DisplayTime))]
+    [XmlInclude(typeof(LatencyStats))]
+    [XmlInclude(typeof(LatencyHistogram))]
+    [XmlInclude(typeof(FrameCounters))]
+    [XmlInclude(typeof(LoadTimeouts))]
+    [XmlInclude(typeof(LatchSkew))]
+    [XmlInclude(typeof(LinkSpeed))]
+    [XmlInclude(typeof(LinkStatus))]
+    [XmlInclude(typeof(Palette))]
+    [XmlInclude(typeof(PaletteFrame))]
+    [XmlInclude(typeof(SequencePaletteFrame))]
+    [XmlInclude(typeof(FrameCrc))]
+    [XmlInclude(typeof(LinkErrors))]
+    [XmlInclude(typeof(LinkResyncs))]
+    [XmlInclude(typeof(UpdateLatency))]
     [Description("Formats a sequence of values as specific RgbArray register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -1793,9 +2089,9 @@ namespace Harp.RgbArray
     }
 
     /// <summary>
-    /// Represents a register that the pulse period in milliseconds for digital outputs.
+    /// Represents a register that the pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.
     /// </summary>
-    [Description("The pulse period in milliseconds for digital outputs.")]
+    [Description("The pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.")]
     public partial class DigitalOutputPulsePeriod
     {
         /// <summary>
@@ -2081,1049 +2377,6720 @@ namespace Harp.RgbArray
         }
     }
 
+    /// <summary>
+    /// Represents a register that the number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.
+    /// </summary>
+    [Description("The number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.")]
+    public partial class StripLedCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StripLedCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 52;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StripLedCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StripLedCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StripLedCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StripLedCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StripLedCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StripLedCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StripLedCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StripLedCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StripLedCount register.
+    /// </summary>
+    /// <seealso cref="StripLedCount"/>
+    [Description("Filters and selects timestamped messages from the StripLedCount register.")]
+    public partial class TimestampedStripLedCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StripLedCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StripLedCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StripLedCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return StripLedCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.
+    /// </summary>
+    [Description("Updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.")]
+    public partial class RgbWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RgbWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 53;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RgbWindow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RgbWindow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 99;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RgbWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RgbWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RgbWindow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RgbWindow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RgbWindow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RgbWindow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RgbWindow register.
+    /// </summary>
+    /// <seealso cref="RgbWindow"/>
+    [Description("Filters and selects timestamped messages from the RgbWindow register.")]
+    public partial class TimestampedRgbWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RgbWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RgbWindow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RgbWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return RgbWindow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.
+    /// </summary>
+    [Description("Updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.")]
+    public partial class RgbScatter
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RgbScatter"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 54;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RgbScatter"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RgbScatter"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 64;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RgbScatter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RgbScatter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RgbScatter"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RgbScatter"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RgbScatter"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RgbScatter"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RgbScatter register.
+    /// </summary>
+    /// <seealso cref="RgbScatter"/>
+    [Description("Filters and selects timestamped messages from the RgbScatter register.")]
+    public partial class TimestampedRgbScatter
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RgbScatter"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RgbScatter.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RgbScatter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return RgbScatter.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [Description("Appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class SequenceFrame
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceFrame"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 55;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceFrame"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceFrame"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 192;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceFrame"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceFrame"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceFrame"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceFrame"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceFrame register.
+    /// </summary>
+    /// <seealso cref="SequenceFrame"/>
+    [Description("Filters and selects timestamped messages from the SequenceFrame register.")]
+    public partial class TimestampedSequenceFrame
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceFrame"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceFrame.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return SequenceFrame.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.
+    /// </summary>
+    [Description("Controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.")]
+    public partial class SequenceControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 56;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SequenceCommands GetPayload(HarpMessage message)
+        {
+            return (SequenceCommands)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SequenceCommands> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SequenceCommands)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SequenceCommands value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SequenceCommands value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceControl register.
+    /// </summary>
+    /// <seealso cref="SequenceControl"/>
+    [Description("Filters and selects timestamped messages from the SequenceControl register.")]
+    public partial class TimestampedSequenceControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SequenceCommands> GetPayload(HarpMessage message)
+        {
+            return SequenceControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the number of frames stored on both buses.
+    /// </summary>
+    [Description("The number of frames stored on both buses.")]
+    public partial class SequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 57;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceLength register.
+    /// </summary>
+    /// <seealso cref="SequenceLength"/>
+    [Description("Filters and selects timestamped messages from the SequenceLength register.")]
+    public partial class TimestampedSequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return SequenceLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.
+    /// </summary>
+    [Description("Scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.")]
+    public partial class Brightness
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Brightness"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 58;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Brightness"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Brightness"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Brightness"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Brightness"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Brightness"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Brightness"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Brightness"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Brightness"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Brightness register.
+    /// </summary>
+    /// <seealso cref="Brightness"/>
+    [Description("Filters and selects timestamped messages from the Brightness register.")]
+    public partial class TimestampedBrightness
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Brightness"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Brightness.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Brightness"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Brightness.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enables a 2.2 gamma correction of the colors when they are sent to the buses.
+    /// </summary>
+    [Description("Enables a 2.2 gamma correction of the colors when they are sent to the buses.")]
+    public partial class GammaCorrection
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="GammaCorrection"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 59;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="GammaCorrection"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="GammaCorrection"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="GammaCorrection"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="GammaCorrection"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="GammaCorrection"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="GammaCorrection"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="GammaCorrection"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="GammaCorrection"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// GammaCorrection register.
+    /// </summary>
+    /// <seealso cref="GammaCorrection"/>
+    [Description("Filters and selects timestamped messages from the GammaCorrection register.")]
+    public partial class TimestampedGammaCorrection
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="GammaCorrection"/> register. This field is constant.
+        /// </summary>
+        public const int Address = GammaCorrection.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="GammaCorrection"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return GammaCorrection.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.
+    /// </summary>
+    [Description("Runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.")]
+    public partial class Effect
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Effect"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 60;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Effect"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Effect"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 6;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Effect"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Effect"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Effect"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Effect"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Effect"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Effect"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Effect register.
+    /// </summary>
+    /// <seealso cref="Effect"/>
+    [Description("Filters and selects timestamped messages from the Effect register.")]
+    public partial class TimestampedEffect
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Effect"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Effect.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Effect"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return Effect.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.
+    /// </summary>
+    [Description("The duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.")]
+    public partial class FadeDuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FadeDuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 61;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FadeDuration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FadeDuration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FadeDuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FadeDuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FadeDuration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FadeDuration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FadeDuration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FadeDuration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FadeDuration register.
+    /// </summary>
+    /// <seealso cref="FadeDuration"/>
+    [Description("Filters and selects timestamped messages from the FadeDuration register.")]
+    public partial class TimestampedFadeDuration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FadeDuration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FadeDuration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FadeDuration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return FadeDuration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.
+    /// </summary>
+    [Description("The number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.")]
+    public partial class ExtendedLedCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExtendedLedCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 62;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ExtendedLedCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ExtendedLedCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ExtendedLedCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ExtendedLedCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ExtendedLedCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExtendedLedCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ExtendedLedCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExtendedLedCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ExtendedLedCount register.
+    /// </summary>
+    /// <seealso cref="ExtendedLedCount"/>
+    [Description("Filters and selects timestamped messages from the ExtendedLedCount register.")]
+    public partial class TimestampedExtendedLedCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExtendedLedCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ExtendedLedCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ExtendedLedCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return ExtendedLedCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.
+    /// </summary>
+    [Description("Loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.")]
+    public partial class RgbPage
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RgbPage"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RgbPage"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RgbPage"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 100;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RgbPage"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RgbPage"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RgbPage"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RgbPage"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RgbPage"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RgbPage"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RgbPage register.
+    /// </summary>
+    /// <seealso cref="RgbPage"/>
+    [Description("Filters and selects timestamped messages from the RgbPage register.")]
+    public partial class TimestampedRgbPage
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RgbPage"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RgbPage.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RgbPage"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return RgbPage.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.
+    /// </summary>
+    [Description("The number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.")]
+    public partial class CoalescedFrames
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CoalescedFrames"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CoalescedFrames"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CoalescedFrames"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CoalescedFrames"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CoalescedFrames"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CoalescedFrames"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CoalescedFrames"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CoalescedFrames"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CoalescedFrames"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CoalescedFrames register.
+    /// </summary>
+    /// <seealso cref="CoalescedFrames"/>
+    [Description("Filters and selects timestamped messages from the CoalescedFrames register.")]
+    public partial class TimestampedCoalescedFrames
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CoalescedFrames"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CoalescedFrames.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CoalescedFrames"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return CoalescedFrames.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.
+    /// </summary>
+    [Description("Updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.")]
+    public partial class IndependentBuses
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IndependentBuses"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IndependentBuses"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IndependentBuses"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IndependentBuses"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IndependentBuses"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IndependentBuses"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IndependentBuses"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IndependentBuses"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IndependentBuses"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IndependentBuses register.
+    /// </summary>
+    /// <seealso cref="IndependentBuses"/>
+    [Description("Filters and selects timestamped messages from the IndependentBuses register.")]
+    public partial class TimestampedIndependentBuses
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IndependentBuses"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IndependentBuses.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IndependentBuses"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return IndependentBuses.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].
+    /// </summary>
+    [Description("The Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].")]
+    public partial class PresentationTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PresentationTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PresentationTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PresentationTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PresentationTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PresentationTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PresentationTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PresentationTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PresentationTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PresentationTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PresentationTime register.
+    /// </summary>
+    /// <seealso cref="PresentationTime"/>
+    [Description("Filters and selects timestamped messages from the PresentationTime register.")]
+    public partial class TimestampedPresentationTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PresentationTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PresentationTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PresentationTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return PresentationTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [Description("Queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class ScheduledRgbState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduledRgbState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ScheduledRgbState"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ScheduledRgbState"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 192;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ScheduledRgbState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ScheduledRgbState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ScheduledRgbState"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduledRgbState"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ScheduledRgbState"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduledRgbState"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ScheduledRgbState register.
+    /// </summary>
+    /// <seealso cref="ScheduledRgbState"/>
+    [Description("Filters and selects timestamped messages from the ScheduledRgbState register.")]
+    public partial class TimestampedScheduledRgbState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduledRgbState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ScheduledRgbState.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ScheduledRgbState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return ScheduledRgbState.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [Description("Appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class FrameRing
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameRing"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FrameRing"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FrameRing"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 192;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FrameRing"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FrameRing"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FrameRing"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameRing"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FrameRing"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameRing"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FrameRing register.
+    /// </summary>
+    /// <seealso cref="FrameRing"/>
+    [Description("Filters and selects timestamped messages from the FrameRing register.")]
+    public partial class TimestampedFrameRing
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameRing"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FrameRing.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FrameRing"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return FrameRing.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the number of frames on the ring. Writing 0 clears the ring.
+    /// </summary>
+    [Description("The number of frames on the ring. Writing 0 clears the ring.")]
+    public partial class FrameRingCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameRingCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FrameRingCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FrameRingCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FrameRingCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FrameRingCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FrameRingCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameRingCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FrameRingCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameRingCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FrameRingCount register.
+    /// </summary>
+    /// <seealso cref="FrameRingCount"/>
+    [Description("Filters and selects timestamped messages from the FrameRingCount register.")]
+    public partial class TimestampedFrameRingCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameRingCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FrameRingCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FrameRingCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return FrameRingCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the index of the frame of the ring shown on the next step.
+    /// </summary>
+    [Description("The index of the frame of the ring shown on the next step.")]
+    public partial class FrameRingHead
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameRingHead"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FrameRingHead"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FrameRingHead"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FrameRingHead"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FrameRingHead"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FrameRingHead"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameRingHead"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FrameRingHead"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameRingHead"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FrameRingHead register.
+    /// </summary>
+    /// <seealso cref="FrameRingHead"/>
+    [Description("Filters and selects timestamped messages from the FrameRingHead register.")]
+    public partial class TimestampedFrameRingHead
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameRingHead"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FrameRingHead.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FrameRingHead"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return FrameRingHead.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the index of the ring where the next frame is appended.
+    /// </summary>
+    [Description("The index of the ring where the next frame is appended.")]
+    public partial class FrameRingTail
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameRingTail"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FrameRingTail"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FrameRingTail"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FrameRingTail"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FrameRingTail"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FrameRingTail"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameRingTail"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FrameRingTail"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameRingTail"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FrameRingTail register.
+    /// </summary>
+    /// <seealso cref="FrameRingTail"/>
+    [Description("Filters and selects timestamped messages from the FrameRingTail register.")]
+    public partial class TimestampedFrameRingTail
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameRingTail"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FrameRingTail.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FrameRingTail"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return FrameRingTail.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.
+    /// </summary>
+    [Description("The time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.")]
+    public partial class PulseOnTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseOnTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseOnTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseOnTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseOnTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseOnTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseOnTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseOnTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseOnTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseOnTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseOnTime register.
+    /// </summary>
+    /// <seealso cref="PulseOnTime"/>
+    [Description("Filters and selects timestamped messages from the PulseOnTime register.")]
+    public partial class TimestampedPulseOnTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseOnTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseOnTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseOnTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return PulseOnTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.
+    /// </summary>
+    [Description("The time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.")]
+    public partial class PulseOffTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseOffTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 73;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseOffTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseOffTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseOffTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseOffTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseOffTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseOffTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseOffTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseOffTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseOffTime register.
+    /// </summary>
+    /// <seealso cref="PulseOffTime"/>
+    [Description("Filters and selects timestamped messages from the PulseOffTime register.")]
+    public partial class TimestampedPulseOffTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseOffTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseOffTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseOffTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return PulseOffTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.
+    /// </summary>
+    [Description("The microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.")]
+    public partial class DisplayTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DisplayTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 74;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DisplayTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DisplayTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DisplayTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DisplayTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DisplayTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DisplayTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DisplayTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DisplayTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DisplayTime register.
+    /// </summary>
+    /// <seealso cref="DisplayTime"/>
+    [Description("Filters and selects timestamped messages from the DisplayTime register.")]
+    public partial class TimestampedDisplayTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DisplayTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DisplayTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DisplayTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DisplayTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.
+    /// </summary>
+    [Description("The min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.")]
+    public partial class LatencyStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LatencyStats"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LatencyStats"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 12;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LatencyStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LatencyStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LatencyStats"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyStats"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LatencyStats"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyStats"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LatencyStats register.
+    /// </summary>
+    /// <seealso cref="LatencyStats"/>
+    [Description("Filters and selects timestamped messages from the LatencyStats register.")]
+    public partial class TimestampedLatencyStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LatencyStats.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LatencyStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return LatencyStats.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.
+    /// </summary>
+    [Description("The number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.")]
+    public partial class LatencyHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 76;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LatencyHistogram"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyHistogram"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LatencyHistogram"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyHistogram"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LatencyHistogram register.
+    /// </summary>
+    /// <seealso cref="LatencyHistogram"/>
+    [Description("Filters and selects timestamped messages from the LatencyHistogram register.")]
+    public partial class TimestampedLatencyHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LatencyHistogram.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return LatencyHistogram.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.
+    /// </summary>
+    [Description("The number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.")]
+    public partial class FrameCounters
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameCounters"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 77;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FrameCounters"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FrameCounters"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FrameCounters"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FrameCounters"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FrameCounters"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameCounters"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FrameCounters"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameCounters"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FrameCounters register.
+    /// </summary>
+    /// <seealso cref="FrameCounters"/>
+    [Description("Filters and selects timestamped messages from the FrameCounters register.")]
+    public partial class TimestampedFrameCounters
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameCounters"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FrameCounters.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FrameCounters"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return FrameCounters.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.
+    /// </summary>
+    [Description("The number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.")]
+    public partial class LoadTimeouts
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadTimeouts"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 78;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LoadTimeouts"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LoadTimeouts"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoadTimeouts"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoadTimeouts"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LoadTimeouts"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadTimeouts"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LoadTimeouts"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadTimeouts"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LoadTimeouts register.
+    /// </summary>
+    /// <seealso cref="LoadTimeouts"/>
+    [Description("Filters and selects timestamped messages from the LoadTimeouts register.")]
+    public partial class TimestampedLoadTimeouts
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadTimeouts"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LoadTimeouts.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LoadTimeouts"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return LoadTimeouts.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.
+    /// </summary>
+    [Description("The microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.")]
+    public partial class LatchSkew
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatchSkew"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 79;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LatchSkew"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LatchSkew"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LatchSkew"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static short[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<short>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LatchSkew"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<short>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LatchSkew"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatchSkew"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, short[] value)
+        {
+            return HarpMessage.FromInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LatchSkew"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatchSkew"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, short[] value)
+        {
+            return HarpMessage.FromInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LatchSkew register.
+    /// </summary>
+    /// <seealso cref="LatchSkew"/>
+    [Description("Filters and selects timestamped messages from the LatchSkew register.")]
+    public partial class TimestampedLatchSkew
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatchSkew"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LatchSkew.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LatchSkew"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short[]> GetPayload(HarpMessage message)
+        {
+            return LatchSkew.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.
+    /// </summary>
+    [Description("The fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.")]
+    public partial class LinkSpeed
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LinkSpeed"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LinkSpeed"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LinkSpeed"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LinkSpeed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static LinkSpeedConfig GetPayload(HarpMessage message)
+        {
+            return (LinkSpeedConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LinkSpeed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LinkSpeedConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((LinkSpeedConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LinkSpeed"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LinkSpeed"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, LinkSpeedConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LinkSpeed"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LinkSpeed"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, LinkSpeedConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LinkSpeed register.
+    /// </summary>
+    /// <seealso cref="LinkSpeed"/>
+    [Description("Filters and selects timestamped messages from the LinkSpeed register.")]
+    public partial class TimestampedLinkSpeed
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LinkSpeed"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LinkSpeed.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LinkSpeed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LinkSpeedConfig> GetPayload(HarpMessage message)
+        {
+            return LinkSpeed.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.
+    /// </summary>
+    [Description("The speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.")]
+    public partial class LinkStatus
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LinkStatus"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 81;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LinkStatus"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LinkStatus"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LinkStatus"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LinkStatus"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LinkStatus"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LinkStatus"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LinkStatus"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LinkStatus"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LinkStatus register.
+    /// </summary>
+    /// <seealso cref="LinkStatus"/>
+    [Description("Filters and selects timestamped messages from the LinkStatus register.")]
+    public partial class TimestampedLinkStatus
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LinkStatus"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LinkStatus.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LinkStatus"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return LinkStatus.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.
+    /// </summary>
+    [Description("The colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.")]
+    public partial class Palette
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Palette"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 82;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Palette"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Palette"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 192;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Palette"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Palette"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Palette"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Palette"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Palette"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Palette"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Palette register.
+    /// </summary>
+    /// <seealso cref="Palette"/>
+    [Description("Filters and selects timestamped messages from the Palette register.")]
+    public partial class TimestampedPalette
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Palette"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Palette.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Palette"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return Palette.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.
+    /// </summary>
+    [Description("Shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.")]
+    public partial class PaletteFrame
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PaletteFrame"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 83;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PaletteFrame"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PaletteFrame"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 64;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PaletteFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PaletteFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PaletteFrame"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PaletteFrame"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PaletteFrame"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PaletteFrame"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PaletteFrame register.
+    /// </summary>
+    /// <seealso cref="PaletteFrame"/>
+    [Description("Filters and selects timestamped messages from the PaletteFrame register.")]
+    public partial class TimestampedPaletteFrame
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PaletteFrame"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PaletteFrame.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PaletteFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return PaletteFrame.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.
+    /// </summary>
+    [Description("Appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.")]
+    public partial class SequencePaletteFrame
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequencePaletteFrame"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 84;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequencePaletteFrame"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequencePaletteFrame"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 64;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequencePaletteFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequencePaletteFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequencePaletteFrame"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequencePaletteFrame"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequencePaletteFrame"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequencePaletteFrame"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequencePaletteFrame register.
+    /// </summary>
+    /// <seealso cref="SequencePaletteFrame"/>
+    [Description("Filters and selects timestamped messages from the SequencePaletteFrame register.")]
+    public partial class TimestampedSequencePaletteFrame
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequencePaletteFrame"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequencePaletteFrame.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequencePaletteFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return SequencePaletteFrame.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.
+    /// </summary>
+    [Description("The CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.")]
+    public partial class FrameCrc
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameCrc"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 85;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FrameCrc"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FrameCrc"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FrameCrc"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FrameCrc"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FrameCrc"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameCrc"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FrameCrc"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameCrc"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FrameCrc register.
+    /// </summary>
+    /// <seealso cref="FrameCrc"/>
+    [Description("Filters and selects timestamped messages from the FrameCrc register.")]
+    public partial class TimestampedFrameCrc
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameCrc"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FrameCrc.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FrameCrc"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return FrameCrc.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.
+    /// </summary>
+    [Description("The errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.")]
+    public partial class LinkErrors
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LinkErrors"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 86;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LinkErrors"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LinkErrors"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 12;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LinkErrors"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LinkErrors"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LinkErrors"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LinkErrors"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LinkErrors"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LinkErrors"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LinkErrors register.
+    /// </summary>
+    /// <seealso cref="LinkErrors"/>
+    [Description("Filters and selects timestamped messages from the LinkErrors register.")]
+    public partial class TimestampedLinkErrors
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LinkErrors"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LinkErrors.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LinkErrors"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return LinkErrors.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.
+    /// </summary>
+    [Description("The number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.")]
+    public partial class LinkResyncs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LinkResyncs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 87;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LinkResyncs"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LinkResyncs"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LinkResyncs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LinkResyncs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LinkResyncs"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LinkResyncs"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LinkResyncs"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LinkResyncs"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LinkResyncs register.
+    /// </summary>
+    /// <seealso cref="LinkResyncs"/>
+    [Description("Filters and selects timestamped messages from the LinkResyncs register.")]
+    public partial class TimestampedLinkResyncs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LinkResyncs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LinkResyncs.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LinkResyncs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return LinkResyncs.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.
+    /// </summary>
+    [Description("The latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.")]
+    public partial class UpdateLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UpdateLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 88;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="UpdateLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="UpdateLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 6;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="UpdateLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="UpdateLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="UpdateLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UpdateLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="UpdateLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UpdateLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// UpdateLatency register.
+    /// </summary>
+    /// <seealso cref="UpdateLatency"/>
+    [Description("Filters and selects timestamped messages from the UpdateLatency register.")]
+    public partial class TimestampedUpdateLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UpdateLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = UpdateLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="UpdateLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return UpdateLatency.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// RgbArray device.
     /// </summary>
-    /// <seealso cref="CreateLedStatusPayload"/>
-    /// <seealso cref="CreateLedCountPayload"/>
-    /// <seealso cref="CreateRgbStatePayload"/>
-    /// <seealso cref="CreateRgbBus0StatePayload"/>
-    /// <seealso cref="CreateRgbBus1StatePayload"/>
-    /// <seealso cref="CreateRgbOffStatePayload"/>
-    /// <seealso cref="CreateDI0ModePayload"/>
-    /// <seealso cref="CreateDO0ModePayload"/>
-    /// <seealso cref="CreateDO1ModePayload"/>
-    /// <seealso cref="CreateLatchOnNextUpdatePayload"/>
-    /// <seealso cref="CreateDigitalInputStatePayload"/>
-    /// <seealso cref="CreateOutputSetPayload"/>
-    /// <seealso cref="CreateOutputClearPayload"/>
-    /// <seealso cref="CreateOutputTogglePayload"/>
-    /// <seealso cref="CreateOutputStatePayload"/>
-    /// <seealso cref="CreateDigitalOutputPulsePeriodPayload"/>
-    /// <seealso cref="CreateDigitalOutputPulseCountPayload"/>
-    /// <seealso cref="CreateEventEnablePayload"/>
-    [XmlInclude(typeof(CreateLedStatusPayload))]
-    [XmlInclude(typeof(CreateLedCountPayload))]
-    [XmlInclude(typeof(CreateRgbStatePayload))]
-    [XmlInclude(typeof(CreateRgbBus0StatePayload))]
-    [XmlInclude(typeof(CreateRgbBus1StatePayload))]
-    [XmlInclude(typeof(CreateRgbOffStatePayload))]
-    [XmlInclude(typeof(CreateDI0ModePayload))]
-    [XmlInclude(typeof(CreateDO0ModePayload))]
-    [XmlInclude(typeof(CreateDO1ModePayload))]
-    [XmlInclude(typeof(CreateLatchOnNextUpdatePayload))]
-    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateOutputSetPayload))]
-    [XmlInclude(typeof(CreateOutputClearPayload))]
-    [XmlInclude(typeof(CreateOutputTogglePayload))]
-    [XmlInclude(typeof(CreateOutputStatePayload))]
-    [XmlInclude(typeof(CreateDigitalOutputPulsePeriodPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputPulseCountPayload))]
-    [XmlInclude(typeof(CreateEventEnablePayload))]
-    [XmlInclude(typeof(CreateTimestampedLedStatusPayload))]
-    [XmlInclude(typeof(CreateTimestampedLedCountPayload))]
-    [XmlInclude(typeof(CreateTimestampedRgbStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedRgbBus0StatePayload))]
-    [XmlInclude(typeof(CreateTimestampedRgbBus1StatePayload))]
-    [XmlInclude(typeof(CreateTimestampedRgbOffStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDI0ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedLatchOnNextUpdatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputSetPayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputClearPayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputTogglePayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputPulsePeriodPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputPulseCountPayload))]
-    [XmlInclude(typeof(CreateTimestampedEventEnablePayload))]
-    [Description("Creates standard message payloads for the RgbArray device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateLedStatusPayload"/>
+    /// <seealso cref="CreateLedCountPayload"/>
+    /// <seealso cref="CreateRgbStatePayload"/>
+    /// <seealso cref="CreateRgbBus0StatePayload"/>
+    /// <seealso cref="CreateRgbBus1StatePayload"/>
+    /// <seealso cref="CreateRgbOffStatePayload"/>
+    /// <seealso cref="CreateDI0ModePayload"/>
+    /// <seealso cref="CreateDO0ModePayload"/>
+    /// <seealso cref="CreateDO1ModePayload"/>
+    /// <seealso cref="CreateLatchOnNextUpdatePayload"/>
+    /// <seealso cref="CreateDigitalInputStatePayload"/>
+    /// <seealso cref="CreateOutputSetPayload"/>
+    /// <seealso cref="CreateOutputClearPayload"/>
+    /// <seealso cref="CreateOutputTogglePayload"/>
+    /// <seealso cref="CreateOutputStatePayload"/>
+    /// <seealso cref="CreateDigitalOutputPulsePeriodPayload"/>
+    /// <seealso cref="CreateDigitalOutputPulseCountPayload"/>
+    /// <seealso cref="CreateEventEnablePayload"/>
+    /// <seealso cref="CreateStripLedCountPayload"/>
+    /// <seealso cref="CreateRgbWindowPayload"/>
+    /// <seealso cref="CreateRgbScatterPayload"/>
+    /// <seealso cref="CreateSequenceFramePayload"/>
+    /// <seealso cref="CreateSequenceControlPayload"/>
+    /// <seealso cref="CreateSequenceLengthPayload"/>
+    /// <seealso cref="CreateBrightnessPayload"/>
+    /// <seealso cref="CreateGammaCorrectionPayload"/>
+    /// <seealso cref="CreateEffectPayload"/>
+    /// <seealso cref="CreateFadeDurationPayload"/>
+    /// <seealso cref="CreateExtendedLedCountPayload"/>
+    /// <seealso cref="CreateRgbPagePayload"/>
+    /// <seealso cref="CreateCoalescedFramesPayload"/>
+    /// <seealso cref="CreateIndependentBusesPayload"/>
+    /// <seealso cref="CreatePresentationTimePayload"/>
+    /// <seealso cref="CreateScheduledRgbStatePayload"/>
+    /// <seealso cref="CreateFrameRingPayload"/>
+    /// <seealso cref="CreateFrameRingCountPayload"/>
+    /// <seealso cref="CreateFrameRingHeadPayload"/>
+    /// <seealso cref="CreateFrameRingTailPayload"/>
+    /// <seealso cref="CreatePulseOnTimePayload"/>
+    /// <seealso cref="CreatePulseOffTimePayload"/>
+    /// <seealso cref="CreateDisplayTimePayload"/>
+    /// <seealso cref="CreateLatencyStatsPayload"/>
+    /// <seealso cref="CreateLatencyHistogramPayload"/>
+    /// <seealso cref="CreateFrameCountersPayload"/>
+    /// <seealso cref="CreateLoadTimeoutsPayload"/>
+    /// <seealso cref="CreateLatchSkewPayload"/>
+    /// <seealso cref="CreateLinkSpeedPayload"/>
+    /// <seealso cref="CreateLinkStatusPayload"/>
+    /// <seealso cref="CreatePalettePayload"/>
+    /// <seealso cref="CreatePaletteFramePayload"/>
+    /// <seealso cref="CreateSequencePaletteFramePayload"/>
+    /// <seealso cref="CreateFrameCrcPayload"/>
+    /// <seealso cref="CreateLinkErrorsPayload"/>
+    /// <seealso cref="CreateLinkResyncsPayload"/>
+    /// <seealso cref="CreateUpdateLatencyPayload"/>
+    [XmlInclude(typeof(CreateLedStatusPayload))]
+    [XmlInclude(typeof(CreateLedCountPayload))]
+    [XmlInclude(typeof(CreateRgbStatePayload))]
+    [XmlInclude(typeof(CreateRgbBus0StatePayload))]
+    [XmlInclude(typeof(CreateRgbBus1StatePayload))]
+    [XmlInclude(typeof(CreateRgbOffStatePayload))]
+    [XmlInclude(typeof(CreateDI0ModePayload))]
+    [XmlInclude(typeof(CreateDO0ModePayload))]
+    [XmlInclude(typeof(CreateDO1ModePayload))]
+    [XmlInclude(typeof(CreateLatchOnNextUpdatePayload))]
+    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateOutputSetPayload))]
+    [XmlInclude(typeof(CreateOutputClearPayload))]
+    [XmlInclude(typeof(CreateOutputTogglePayload))]
+    [XmlInclude(typeof(CreateOutputStatePayload))]
+    [XmlInclude(typeof(CreateDigitalOutputPulsePeriodPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputPulseCountPayload))]
+    [XmlInclude(typeof(CreateEventEnablePayload))]
+    [XmlInclude(typeof(CreateStripLedCountPayload))]
+    [XmlInclude(typeof(CreateRgbWindowPayload))]
+    [XmlInclude(typeof(CreateRgbScatterPayload))]
+    [XmlInclude(typeof(CreateSequenceFramePayload))]
+    [XmlInclude(typeof(CreateSequenceControlPayload))]
+    [XmlInclude(typeof(CreateSequenceLengthPayload))]
+    [XmlInclude(typeof(CreateBrightnessPayload))]
+    [XmlInclude(typeof(CreateGammaCorrectionPayload))]
+    [XmlInclude(typeof(CreateEffectPayload))]
+    [XmlInclude(typeof(CreateFadeDurationPayload))]
+    [XmlInclude(typeof(CreateExtendedLedCountPayload))]
+    [XmlInclude(typeof(CreateRgbPagePayload))]
+    [XmlInclude(typeof(CreateCoalescedFramesPayload))]
+    [XmlInclude(typeof(CreateIndependentBusesPayload))]
+    [XmlInclude(typeof(CreatePresentationTimePayload))]
+    [XmlInclude(typeof(CreateScheduledRgbStatePayload))]
+    [XmlInclude(typeof(CreateFrameRingPayload))]
+    [XmlInclude(typeof(CreateFrameRingCountPayload))]
+    [XmlInclude(typeof(CreateFrameRingHeadPayload))]
+    [XmlInclude(typeof(CreateFrameRingTailPayload))]
+    [XmlInclude(typeof(CreatePulseOnTimePayload))]
+    [XmlInclude(typeof(CreatePulseOffTimePayload))]
+    [XmlInclude(typeof(CreateDisplayTimePayload))]
+    [XmlInclude(typeof(CreateLatencyStatsPayload))]
+    [XmlInclude(typeof(CreateLatencyHistogramPayload))]
+    [XmlInclude(typeof(CreateFrameCountersPayload))]
+    [XmlInclude(typeof(CreateLoadTimeoutsPayload))]
+    [XmlInclude(typeof(CreateLatchSkewPayload))]
+    [XmlInclude(typeof(CreateLinkSpeedPayload))]
+    [XmlInclude(typeof(CreateLinkStatusPayload))]
+    [XmlInclude(typeof(CreatePalettePayload))]
+    [XmlInclude(typeof(CreatePaletteFramePayload))]
+    [XmlInclude(typeof(CreateSequencePaletteFramePayload))]
+    [XmlInclude(typeof(CreateFrameCrcPayload))]
+    [XmlInclude(typeof(CreateLinkErrorsPayload))]
+    [XmlInclude(typeof(CreateLinkResyncsPayload))]
+    [XmlInclude(typeof(CreateUpdateLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedLedStatusPayload))]
+    [XmlInclude(typeof(CreateTimestampedLedCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedRgbStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedRgbBus0StatePayload))]
+    [XmlInclude(typeof(CreateTimestampedRgbBus1StatePayload))]
+    [XmlInclude(typeof(CreateTimestampedRgbOffStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDI0ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedLatchOnNextUpdatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputTogglePayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputPulsePeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputPulseCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedEventEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedStripLedCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedRgbWindowPayload))]
+    [XmlInclude(typeof(CreateTimestampedRgbScatterPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceFramePayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedBrightnessPayload))]
+    [XmlInclude(typeof(CreateTimestampedGammaCorrectionPayload))]
+    [XmlInclude(typeof(CreateTimestampedEffectPayload))]
+    [XmlInclude(typeof(CreateTimestampedFadeDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedExtendedLedCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedRgbPagePayload))]
+    [XmlInclude(typeof(CreateTimestampedCoalescedFramesPayload))]
+    [XmlInclude(typeof(CreateTimestampedIndependentBusesPayload))]
+    [XmlInclude(typeof(CreateTimestampedPresentationTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedScheduledRgbStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedFrameRingPayload))]
+    [XmlInclude(typeof(CreateTimestampedFrameRingCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedFrameRingHeadPayload))]
+    [XmlInclude(typeof(CreateTimestampedFrameRingTailPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseOnTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseOffTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedDisplayTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedLatencyStatsPayload))]
+    [XmlInclude(typeof(CreateTimestampedLatencyHistogramPayload))]
+    [XmlInclude(typeof(CreateTimestampedFrameCountersPayload))]
+    [XmlInclude(typeof(CreateTimestampedLoadTimeoutsPayload))]
+    [XmlInclude(typeof(CreateTimestampedLatchSkewPayload))]
+    [XmlInclude(typeof(CreateTimestampedLinkSpeedPayload))]
+    [XmlInclude(typeof(CreateTimestampedLinkStatusPayload))]
+    [XmlInclude(typeof(CreateTimestampedPalettePayload))]
+    [XmlInclude(typeof(CreateTimestampedPaletteFramePayload))]
+    [XmlInclude(typeof(CreateTimestampedSequencePaletteFramePayload))]
+    [XmlInclude(typeof(CreateTimestampedFrameCrcPayload))]
+    [XmlInclude(typeof(CreateTimestampedLinkErrorsPayload))]
+    [XmlInclude(typeof(CreateTimestampedLinkResyncsPayload))]
+    [XmlInclude(typeof(CreateTimestampedUpdateLatencyPayload))]
+    [Description("Creates standard message payloads for the RgbArray device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateLedStatusPayload();
+        }
+
+        string INamedElement.Name => $"{nameof(RgbArray)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// for register LedStatus.
+    /// </summary>
+    [DisplayName("LedStatusPayload")]
+    [Description("Creates a message payload for register LedStatus.")]
+    public partial class CreateLedStatusPayload
+    {
+        /// <summary>
+        /// Gets or sets the value for register LedStatus.
+        /// </summary>
+        [Description("The value for register LedStatus.")]
+        public byte LedStatus { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LedStatus register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return LedStatus;
+        }
+
+        /// <summary>
+        /// Creates a message for register LedStatus.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LedStatus register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.LedStatus.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// for register LedStatus.
+    /// </summary>
+    [DisplayName("TimestampedLedStatusPayload")]
+    [Description("Creates a timestamped message payload for register LedStatus.")]
+    public partial class CreateTimestampedLedStatusPayload : CreateLedStatusPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message for register LedStatus.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LedStatus register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.LedStatus.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the number of LEDs connected on each bus of the device.
+    /// </summary>
+    [DisplayName("LedCountPayload")]
+    [Description("Creates a message payload that the number of LEDs connected on each bus of the device.")]
+    public partial class CreateLedCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the number of LEDs connected on each bus of the device.
+        /// </summary>
+        [Range(min: long.MinValue, max: 32)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the number of LEDs connected on each bus of the device.")]
+        public byte LedCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LedCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return LedCount;
+        }
+
+        /// <summary>
+        /// Creates a message that the number of LEDs connected on each bus of the device.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LedCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.LedCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the number of LEDs connected on each bus of the device.
+    /// </summary>
+    [DisplayName("TimestampedLedCountPayload")]
+    [Description("Creates a timestamped message payload that the number of LEDs connected on each bus of the device.")]
+    public partial class CreateTimestampedLedCountPayload : CreateLedCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the number of LEDs connected on each bus of the device.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LedCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.LedCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("RgbStatePayload")]
+    [Description("Creates a message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateRgbStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        [Description("The value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
+        public byte[] RgbState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RgbState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return RgbState;
+        }
+
+        /// <summary>
+        /// Creates a message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RgbState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.RgbState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("TimestampedRgbStatePayload")]
+    [Description("Creates a timestamped message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateTimestampedRgbStatePayload : CreateRgbStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RgbState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.RgbState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("RgbBus0StatePayload")]
+    [Description("Creates a message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateRgbBus0StatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        [Description("The value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
+        public byte[] RgbBus0State { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RgbBus0State register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return RgbBus0State;
+        }
+
+        /// <summary>
+        /// Creates a message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RgbBus0State register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.RgbBus0State.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("TimestampedRgbBus0StatePayload")]
+    [Description("Creates a timestamped message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateTimestampedRgbBus0StatePayload : CreateRgbBus0StatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RgbBus0State register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.RgbBus0State.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("RgbBus1StatePayload")]
+    [Description("Creates a message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateRgbBus1StatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        [Description("The value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
+        public byte[] RgbBus1State { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RgbBus1State register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return RgbBus1State;
+        }
+
+        /// <summary>
+        /// Creates a message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RgbBus1State register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.RgbBus1State.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("TimestampedRgbBus1StatePayload")]
+    [Description("Creates a timestamped message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateTimestampedRgbBus1StatePayload : CreateRgbBus1StatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RgbBus1State register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.RgbBus1State.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the RGB color of the LEDs when they are off.
+    /// </summary>
+    [DisplayName("RgbOffStatePayload")]
+    [Description("Creates a message payload that the RGB color of the LEDs when they are off.")]
+    public partial class CreateRgbOffStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the RGB color of the LEDs when they are off.
+        /// </summary>
+        [Description("The value that the RGB color of the LEDs when they are off.")]
+        public byte[] RgbOffState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RgbOffState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return RgbOffState;
+        }
+
+        /// <summary>
+        /// Creates a message that the RGB color of the LEDs when they are off.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RgbOffState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.RgbOffState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the RGB color of the LEDs when they are off.
+    /// </summary>
+    [DisplayName("TimestampedRgbOffStatePayload")]
+    [Description("Creates a timestamped message payload that the RGB color of the LEDs when they are off.")]
+    public partial class CreateTimestampedRgbOffStatePayload : CreateRgbOffStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the RGB color of the LEDs when they are off.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RgbOffState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.RgbOffState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// for register DI0Mode.
+    /// </summary>
+    [DisplayName("DI0ModePayload")]
+    [Description("Creates a message payload for register DI0Mode.")]
+    public partial class CreateDI0ModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value for register DI0Mode.
+        /// </summary>
+        [Description("The value for register DI0Mode.")]
+        public DI0ModeConfig DI0Mode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DI0Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DI0ModeConfig GetPayload()
+        {
+            return DI0Mode;
+        }
+
+        /// <summary>
+        /// Creates a message for register DI0Mode.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DI0Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.DI0Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// for register DI0Mode.
+    /// </summary>
+    [DisplayName("TimestampedDI0ModePayload")]
+    [Description("Creates a timestamped message payload for register DI0Mode.")]
+    public partial class CreateTimestampedDI0ModePayload : CreateDI0ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message for register DI0Mode.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DI0Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.DI0Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// for register DO0Mode.
+    /// </summary>
+    [DisplayName("DO0ModePayload")]
+    [Description("Creates a message payload for register DO0Mode.")]
+    public partial class CreateDO0ModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value for register DO0Mode.
+        /// </summary>
+        [Description("The value for register DO0Mode.")]
+        public DOModeConfig DO0Mode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DOModeConfig GetPayload()
+        {
+            return DO0Mode;
+        }
+
+        /// <summary>
+        /// Creates a message for register DO0Mode.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.DO0Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// for register DO0Mode.
+    /// </summary>
+    [DisplayName("TimestampedDO0ModePayload")]
+    [Description("Creates a timestamped message payload for register DO0Mode.")]
+    public partial class CreateTimestampedDO0ModePayload : CreateDO0ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message for register DO0Mode.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.DO0Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// for register DO1Mode.
+    /// </summary>
+    [DisplayName("DO1ModePayload")]
+    [Description("Creates a message payload for register DO1Mode.")]
+    public partial class CreateDO1ModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value for register DO1Mode.
+        /// </summary>
+        [Description("The value for register DO1Mode.")]
+        public DOModeConfig DO1Mode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO1Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DOModeConfig GetPayload()
+        {
+            return DO1Mode;
+        }
+
+        /// <summary>
+        /// Creates a message for register DO1Mode.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.DO1Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// for register DO1Mode.
+    /// </summary>
+    [DisplayName("TimestampedDO1ModePayload")]
+    [Description("Creates a timestamped message payload for register DO1Mode.")]
+    public partial class CreateTimestampedDO1ModePayload : CreateDO1ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message for register DO1Mode.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.DO1Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+    /// </summary>
+    [DisplayName("LatchOnNextUpdatePayload")]
+    [Description("Creates a message payload that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.")]
+    public partial class CreateLatchOnNextUpdatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+        /// </summary>
+        [Description("The value that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.")]
+        public EnableFlag LatchOnNextUpdate { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LatchOnNextUpdate register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return LatchOnNextUpdate;
+        }
+
+        /// <summary>
+        /// Creates a message that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LatchOnNextUpdate register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.LatchOnNextUpdate.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+    /// </summary>
+    [DisplayName("TimestampedLatchOnNextUpdatePayload")]
+    [Description("Creates a timestamped message payload that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.")]
+    public partial class CreateTimestampedLatchOnNextUpdatePayload : CreateLatchOnNextUpdatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LatchOnNextUpdate register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.LatchOnNextUpdate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reflects the state of DI digital lines of each Port.
+    /// </summary>
+    [DisplayName("DigitalInputStatePayload")]
+    [Description("Creates a message payload that reflects the state of DI digital lines of each Port.")]
+    public partial class CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reflects the state of DI digital lines of each Port.
+        /// </summary>
+        [Description("The value that reflects the state of DI digital lines of each Port.")]
+        public DigitalInputs DigitalInputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputState;
+        }
+
+        /// <summary>
+        /// Creates a message that reflects the state of DI digital lines of each Port.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.DigitalInputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reflects the state of DI digital lines of each Port.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputStatePayload")]
+    [Description("Creates a timestamped message payload that reflects the state of DI digital lines of each Port.")]
+    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reflects the state of DI digital lines of each Port.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("OutputSetPayload")]
+    [Description("Creates a message payload that set the specified digital output lines.")]
+    public partial class CreateOutputSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that set the specified digital output lines.
+        /// </summary>
+        [Description("The value that set the specified digital output lines.")]
+        public DigitalOutputs OutputSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputSet;
+        }
+
+        /// <summary>
+        /// Creates a message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.OutputSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputSetPayload")]
+    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
+    public partial class CreateTimestampedOutputSetPayload : CreateOutputSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.OutputSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("OutputClearPayload")]
+    [Description("Creates a message payload that clear the specified digital output lines.")]
+    public partial class CreateOutputClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that clear the specified digital output lines.
+        /// </summary>
+        [Description("The value that clear the specified digital output lines.")]
+        public DigitalOutputs OutputClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputClear;
+        }
+
+        /// <summary>
+        /// Creates a message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.OutputClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputClearPayload")]
+    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
+    public partial class CreateTimestampedOutputClearPayload : CreateOutputClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.OutputClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that toggle the specified digital output lines.
+    /// </summary>
+    [DisplayName("OutputTogglePayload")]
+    [Description("Creates a message payload that toggle the specified digital output lines.")]
+    public partial class CreateOutputTogglePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that toggle the specified digital output lines.
+        /// </summary>
+        [Description("The value that toggle the specified digital output lines.")]
+        public DigitalOutputs OutputToggle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputToggle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputToggle;
+        }
+
+        /// <summary>
+        /// Creates a message that toggle the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputToggle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.OutputToggle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that toggle the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputTogglePayload")]
+    [Description("Creates a timestamped message payload that toggle the specified digital output lines.")]
+    public partial class CreateTimestampedOutputTogglePayload : CreateOutputTogglePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that toggle the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputToggle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.OutputToggle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write the state of all digital output lines.
+    /// </summary>
+    [DisplayName("OutputStatePayload")]
+    [Description("Creates a message payload that write the state of all digital output lines.")]
+    public partial class CreateOutputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write the state of all digital output lines.
+        /// </summary>
+        [Description("The value that write the state of all digital output lines.")]
+        public DigitalOutputs OutputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputState;
+        }
+
+        /// <summary>
+        /// Creates a message that write the state of all digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.OutputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write the state of all digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputStatePayload")]
+    [Description("Creates a timestamped message payload that write the state of all digital output lines.")]
+    public partial class CreateTimestampedOutputStatePayload : CreateOutputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write the state of all digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.OutputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.
+    /// </summary>
+    [DisplayName("DigitalOutputPulsePeriodPayload")]
+    [Description("Creates a message payload that the pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.")]
+    public partial class CreateDigitalOutputPulsePeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.
+        /// </summary>
+        [Description("The value that the pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.")]
+        public ushort DigitalOutputPulsePeriod { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputPulsePeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DigitalOutputPulsePeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that the pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputPulsePeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.DigitalOutputPulsePeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputPulsePeriodPayload")]
+    [Description("Creates a timestamped message payload that the pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.")]
+    public partial class CreateTimestampedDigitalOutputPulsePeriodPayload : CreateDigitalOutputPulsePeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the pulse period in milliseconds for digital outputs. Writing it sets PulseOnTime and PulseOffTime to half of the period each.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputPulsePeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.DigitalOutputPulsePeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that triggers the specified number of pulses on the digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputPulseCountPayload")]
+    [Description("Creates a message payload that triggers the specified number of pulses on the digital output lines.")]
+    public partial class CreateDigitalOutputPulseCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that triggers the specified number of pulses on the digital output lines.
+        /// </summary>
+        [Description("The value that triggers the specified number of pulses on the digital output lines.")]
+        public byte DigitalOutputPulseCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputPulseCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return DigitalOutputPulseCount;
+        }
+
+        /// <summary>
+        /// Creates a message that triggers the specified number of pulses on the digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputPulseCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.DigitalOutputPulseCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that triggers the specified number of pulses on the digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputPulseCountPayload")]
+    [Description("Creates a timestamped message payload that triggers the specified number of pulses on the digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputPulseCountPayload : CreateDigitalOutputPulseCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that triggers the specified number of pulses on the digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputPulseCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.DigitalOutputPulseCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the active events in the device.
+    /// </summary>
+    [DisplayName("EventEnablePayload")]
+    [Description("Creates a message payload that specifies the active events in the device.")]
+    public partial class CreateEventEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the active events in the device.
+        /// </summary>
+        [Description("The value that specifies the active events in the device.")]
+        public RgbArrayEvents EventEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EventEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public RgbArrayEvents GetPayload()
+        {
+            return EventEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the active events in the device.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EventEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.EventEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the active events in the device.
+    /// </summary>
+    [DisplayName("TimestampedEventEnablePayload")]
+    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
+    public partial class CreateTimestampedEventEnablePayload : CreateEventEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the active events in the device.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EventEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.EventEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.
+    /// </summary>
+    [DisplayName("StripLedCountPayload")]
+    [Description("Creates a message payload that the number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.")]
+    public partial class CreateStripLedCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.
+        /// </summary>
+        [Description("The value that the number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.")]
+        public byte[] StripLedCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StripLedCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return StripLedCount;
+        }
+
+        /// <summary>
+        /// Creates a message that the number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StripLedCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.StripLedCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.
+    /// </summary>
+    [DisplayName("TimestampedStripLedCountPayload")]
+    [Description("Creates a timestamped message payload that the number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.")]
+    public partial class CreateTimestampedStripLedCountPayload : CreateStripLedCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the number of LEDs on each parallel strip of each bus, up to 31. [S0 S1 ... S7]. Keep S1 to S7 at zero to use the single RGB output.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StripLedCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.StripLedCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.
+    /// </summary>
+    [DisplayName("RgbWindowPayload")]
+    [Description("Creates a message payload that updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.")]
+    public partial class CreateRgbWindowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.
+        /// </summary>
+        [Description("The value that updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.")]
+        public byte[] RgbWindow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RgbWindow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return RgbWindow;
+        }
+
+        /// <summary>
+        /// Creates a message that updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RgbWindow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.RgbWindow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.
+    /// </summary>
+    [DisplayName("TimestampedRgbWindowPayload")]
+    [Description("Creates a timestamped message payload that updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.")]
+    public partial class CreateTimestampedRgbWindowPayload : CreateRgbWindowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that updates a range of LEDs of one bus. [Bus FirstLed LedCount R0 G0 B0 R1 G1 B1 ...]. Only the colors of the first LedCount LEDs are used.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RgbWindow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.RgbWindow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.
+    /// </summary>
+    [DisplayName("RgbScatterPayload")]
+    [Description("Creates a message payload that updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.")]
+    public partial class CreateRgbScatterPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.
+        /// </summary>
+        [Description("The value that updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.")]
+        public byte[] RgbScatter { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RgbScatter register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return RgbScatter;
+        }
+
+        /// <summary>
+        /// Creates a message that updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RgbScatter register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.RgbScatter.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.
+    /// </summary>
+    [DisplayName("TimestampedRgbScatterPayload")]
+    [Description("Creates a timestamped message payload that updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.")]
+    public partial class CreateTimestampedRgbScatterPayload : CreateRgbScatterPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that updates a list of up to 16 LEDs. [Index0 R0 G0 B0 Index1 R1 G1 B1 ...]. Bit 7 of the index selects the bus 1 and an index of 255 ends the list.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RgbScatter register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.RgbScatter.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("SequenceFramePayload")]
+    [Description("Creates a message payload that appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateSequenceFramePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        [Description("The value that appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].")]
+        public byte[] SequenceFrame { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceFrame register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return SequenceFrame;
+        }
+
+        /// <summary>
+        /// Creates a message that appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SequenceFrame register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.SequenceFrame.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("TimestampedSequenceFramePayload")]
+    [Description("Creates a timestamped message payload that appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateTimestampedSequenceFramePayload : CreateSequenceFramePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that appends a frame to the sequence stored on the buses, with LedCount LEDs of each bus. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SequenceFrame register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.SequenceFrame.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.
+    /// </summary>
+    [DisplayName("SequenceControlPayload")]
+    [Description("Creates a message payload that controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.")]
+    public partial class CreateSequenceControlPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.
+        /// </summary>
+        [Description("The value that controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.")]
+        public SequenceCommands SequenceControl { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceControl register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SequenceCommands GetPayload()
+        {
+            return SequenceControl;
+        }
+
+        /// <summary>
+        /// Creates a message that controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SequenceControl register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.SequenceControl.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.
+    /// </summary>
+    [DisplayName("TimestampedSequenceControlPayload")]
+    [Description("Creates a timestamped message payload that controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.")]
+    public partial class CreateTimestampedSequenceControlPayload : CreateSequenceControlPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that controls the stored sequence. While it plays, each update shows its next frame, and the first frame follows the last one.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SequenceControl register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.SequenceControl.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the number of frames stored on both buses.
+    /// </summary>
+    [DisplayName("SequenceLengthPayload")]
+    [Description("Creates a message payload that the number of frames stored on both buses.")]
+    public partial class CreateSequenceLengthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the number of frames stored on both buses.
+        /// </summary>
+        [Description("The value that the number of frames stored on both buses.")]
+        public byte SequenceLength { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceLength register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return SequenceLength;
+        }
+
+        /// <summary>
+        /// Creates a message that the number of frames stored on both buses.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SequenceLength register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.SequenceLength.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the number of frames stored on both buses.
+    /// </summary>
+    [DisplayName("TimestampedSequenceLengthPayload")]
+    [Description("Creates a timestamped message payload that the number of frames stored on both buses.")]
+    public partial class CreateTimestampedSequenceLengthPayload : CreateSequenceLengthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the number of frames stored on both buses.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SequenceLength register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.SequenceLength.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.
+    /// </summary>
+    [DisplayName("BrightnessPayload")]
+    [Description("Creates a message payload that scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.")]
+    public partial class CreateBrightnessPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.
+        /// </summary>
+        [Description("The value that scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.")]
+        public byte Brightness { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Brightness register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Brightness;
+        }
+
+        /// <summary>
+        /// Creates a message that scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Brightness register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.Brightness.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.
+    /// </summary>
+    [DisplayName("TimestampedBrightnessPayload")]
+    [Description("Creates a timestamped message payload that scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.")]
+    public partial class CreateTimestampedBrightnessPayload : CreateBrightnessPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that scales the colors of all LEDs when they are sent to the buses. The frame being shown is sent again with the new value.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Brightness register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.Brightness.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables a 2.2 gamma correction of the colors when they are sent to the buses.
+    /// </summary>
+    [DisplayName("GammaCorrectionPayload")]
+    [Description("Creates a message payload that enables a 2.2 gamma correction of the colors when they are sent to the buses.")]
+    public partial class CreateGammaCorrectionPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables a 2.2 gamma correction of the colors when they are sent to the buses.
+        /// </summary>
+        [Description("The value that enables a 2.2 gamma correction of the colors when they are sent to the buses.")]
+        public EnableFlag GammaCorrection { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the GammaCorrection register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return GammaCorrection;
+        }
+
+        /// <summary>
+        /// Creates a message that enables a 2.2 gamma correction of the colors when they are sent to the buses.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the GammaCorrection register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.GammaCorrection.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables a 2.2 gamma correction of the colors when they are sent to the buses.
+    /// </summary>
+    [DisplayName("TimestampedGammaCorrectionPayload")]
+    [Description("Creates a timestamped message payload that enables a 2.2 gamma correction of the colors when they are sent to the buses.")]
+    public partial class CreateTimestampedGammaCorrectionPayload : CreateGammaCorrectionPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables a 2.2 gamma correction of the colors when they are sent to the buses.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the GammaCorrection register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.GammaCorrection.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.
+    /// </summary>
+    [DisplayName("EffectPayload")]
+    [Description("Creates a message payload that runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.")]
+    public partial class CreateEffectPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.
+        /// </summary>
+        [Description("The value that runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.")]
+        public byte[] Effect { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Effect register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return Effect;
+        }
+
+        /// <summary>
+        /// Creates a message that runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Effect register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.Effect.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.
+    /// </summary>
+    [DisplayName("TimestampedEffectPayload")]
+    [Description("Creates a timestamped message payload that runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.")]
+    public partial class CreateTimestampedEffectPayload : CreateEffectPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that runs an effect on both buses until the next update. [Effect Speed Span R G B]. Effect is 0 (None), 1 (Solid), 2 (Chase), 3 (Fade), 4 (Rainbow) or 5 (Breathing). Speed is added to the phase every 10 ms, where 64 is one LED of the chase or 1/256 of the cycles. Span is the number of LEDs lit by the chase or the number of LEDs of a full rainbow.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Effect register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.Effect.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.
+    /// </summary>
+    [DisplayName("FadeDurationPayload")]
+    [Description("Creates a message payload that the duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.")]
+    public partial class CreateFadeDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.
+        /// </summary>
+        [Description("The value that the duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.")]
+        public ushort FadeDuration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the FadeDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return FadeDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that the duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FadeDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.FadeDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.
+    /// </summary>
+    [DisplayName("TimestampedFadeDurationPayload")]
+    [Description("Creates a timestamped message payload that the duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.")]
+    public partial class CreateTimestampedFadeDurationPayload : CreateFadeDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the duration in milliseconds of the crossfade made by the slaves when the LEDs are turned on or off. Zero switches the LEDs right away.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the FadeDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.FadeDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.
+    /// </summary>
+    [DisplayName("ExtendedLedCountPayload")]
+    [Description("Creates a message payload that the number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.")]
+    public partial class CreateExtendedLedCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.
+        /// </summary>
+        [Range(min: long.MinValue, max: 400)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.")]
+        public ushort ExtendedLedCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ExtendedLedCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return ExtendedLedCount;
+        }
+
+        /// <summary>
+        /// Creates a message that the number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ExtendedLedCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.ExtendedLedCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.
+    /// </summary>
+    [DisplayName("TimestampedExtendedLedCountPayload")]
+    [Description("Creates a timestamped message payload that the number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.")]
+    public partial class CreateTimestampedExtendedLedCountPayload : CreateExtendedLedCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the number of LEDs on each bus for the frames loaded with RgbPage, up to 400. Zero disables RgbPage.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ExtendedLedCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.ExtendedLedCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.
+    /// </summary>
+    [DisplayName("RgbPagePayload")]
+    [Description("Creates a message payload that loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.")]
+    public partial class CreateRgbPagePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.
+        /// </summary>
+        [Description("The value that loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.")]
+        public byte[] RgbPage { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RgbPage register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return RgbPage;
+        }
+
+        /// <summary>
+        /// Creates a message that loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RgbPage register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.RgbPage.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.
+    /// </summary>
+    [DisplayName("TimestampedRgbPagePayload")]
+    [Description("Creates a timestamped message payload that loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.")]
+    public partial class CreateTimestampedRgbPagePayload : CreateRgbPagePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that loads up to 32 LEDs of a long frame on one bus. [Flags FirstLedLow FirstLedHigh LedCount R0 G0 B0 R1 G1 B1 ...]. Bit 0 of Flags selects the bus 1 and bit 1 shows the frame on both buses after this page.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RgbPage register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.RgbPage.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.
+    /// </summary>
+    [DisplayName("CoalescedFramesPayload")]
+    [Description("Creates a message payload that the number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.")]
+    public partial class CreateCoalescedFramesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.
+        /// </summary>
+        [Description("The value that the number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.")]
+        public uint CoalescedFrames { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CoalescedFrames register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return CoalescedFrames;
+        }
+
+        /// <summary>
+        /// Creates a message that the number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the CoalescedFrames register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.CoalescedFrames.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.
+    /// </summary>
+    [DisplayName("TimestampedCoalescedFramesPayload")]
+    [Description("Creates a timestamped message payload that the number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.")]
+    public partial class CreateTimestampedCoalescedFramesPayload : CreateCoalescedFramesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the number of RgbState frames that were replaced by a newer frame before being sent to the buses. Frames dropped because a bus had no room are counted on FrameCounters.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the CoalescedFrames register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.CoalescedFrames.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.
+    /// </summary>
+    [DisplayName("IndependentBusesPayload")]
+    [Description("Creates a message payload that updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.")]
+    public partial class CreateIndependentBusesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.
+        /// </summary>
+        [Description("The value that updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.")]
+        public EnableFlag IndependentBuses { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the IndependentBuses register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return IndependentBuses;
+        }
+
+        /// <summary>
+        /// Creates a message that updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the IndependentBuses register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.IndependentBuses.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.
+    /// </summary>
+    [DisplayName("TimestampedIndependentBusesPayload")]
+    [Description("Creates a timestamped message payload that updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.")]
+    public partial class CreateTimestampedIndependentBusesPayload : CreateIndependentBusesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that updates each bus as soon as its own frame is loaded. When disabled, a bus loading a frame waits for the other bus so both are updated together. Writing RgbBus0State or RgbBus1State only loads and updates its own bus.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the IndependentBuses register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.IndependentBuses.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].
+    /// </summary>
+    [DisplayName("PresentationTimePayload")]
+    [Description("Creates a message payload that the Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].")]
+    public partial class CreatePresentationTimePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].
+        /// </summary>
+        [Description("The value that the Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].")]
+        public uint[] PresentationTime { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PresentationTime register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return PresentationTime;
+        }
+
+        /// <summary>
+        /// Creates a message that the Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PresentationTime register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.PresentationTime.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].
+    /// </summary>
+    [DisplayName("TimestampedPresentationTimePayload")]
+    [Description("Creates a timestamped message payload that the Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].")]
+    public partial class CreateTimestampedPresentationTimePayload : CreatePresentationTimePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the Harp time at which the next frame written to ScheduledRgbState is shown. [Seconds Microseconds].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PresentationTime register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.PresentationTime.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("ScheduledRgbStatePayload")]
+    [Description("Creates a message payload that queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateScheduledRgbStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        [Description("The value that queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].")]
+        public byte[] ScheduledRgbState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ScheduledRgbState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return ScheduledRgbState;
+        }
+
+        /// <summary>
+        /// Creates a message that queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ScheduledRgbState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.ScheduledRgbState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("TimestampedScheduledRgbStatePayload")]
+    [Description("Creates a timestamped message payload that queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateTimestampedScheduledRgbStatePayload : CreateScheduledRgbStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that queues a frame for both buses, shown at the time in PresentationTime with a resolution of 32 us. One frame waits on the queue and the write fails until it's shown. A frame whose time has passed is shown as soon as it's loaded. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ScheduledRgbState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.ScheduledRgbState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("FrameRingPayload")]
+    [Description("Creates a message payload that appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateFrameRingPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        [Description("The value that appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].")]
+        public byte[] FrameRing { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the FrameRing register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return FrameRing;
+        }
+
+        /// <summary>
+        /// Creates a message that appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FrameRing register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.FrameRing.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].
+    /// </summary>
+    [DisplayName("TimestampedFrameRingPayload")]
+    [Description("Creates a timestamped message payload that appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].")]
+    public partial class CreateTimestampedFrameRingPayload : CreateFrameRingPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that appends a frame for both buses to the ring of up to 2 frames stepped by DI0. The write fails when the ring is full. [R0 G0 B0 R1 G1 B1 ...].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the FrameRing register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.FrameRing.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the number of frames on the ring. Writing 0 clears the ring.
+    /// </summary>
+    [DisplayName("FrameRingCountPayload")]
+    [Description("Creates a message payload that the number of frames on the ring. Writing 0 clears the ring.")]
+    public partial class CreateFrameRingCountPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Gets or sets the value that the number of frames on the ring. Writing 0 clears the ring.
         /// </summary>
-        public CreateMessage()
+        [Description("The value that the number of frames on the ring. Writing 0 clears the ring.")]
+        public byte FrameRingCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the FrameRingCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
         {
-            Payload = new CreateLedStatusPayload();
+            return FrameRingCount;
         }
 
-        string INamedElement.Name => $"{nameof(RgbArray)}.{GetElementDisplayName(Payload)}";
+        /// <summary>
+        /// Creates a message that the number of frames on the ring. Writing 0 clears the ring.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the FrameRingCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.FrameRingCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the number of frames on the ring. Writing 0 clears the ring.
+    /// </summary>
+    [DisplayName("TimestampedFrameRingCountPayload")]
+    [Description("Creates a timestamped message payload that the number of frames on the ring. Writing 0 clears the ring.")]
+    public partial class CreateTimestampedFrameRingCountPayload : CreateFrameRingCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the number of frames on the ring. Writing 0 clears the ring.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the FrameRingCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.FrameRingCount.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// for register LedStatus.
+    /// that the index of the frame of the ring shown on the next step.
     /// </summary>
-    [DisplayName("LedStatusPayload")]
-    [Description("Creates a message payload for register LedStatus.")]
-    public partial class CreateLedStatusPayload
+    [DisplayName("FrameRingHeadPayload")]
+    [Description("Creates a message payload that the index of the frame of the ring shown on the next step.")]
+    public partial class CreateFrameRingHeadPayload
     {
         /// <summary>
-        /// Gets or sets the value for register LedStatus.
+        /// Gets or sets the value that the index of the frame of the ring shown on the next step.
         /// </summary>
-        [Description("The value for register LedStatus.")]
-        public byte LedStatus { get; set; }
+        [Description("The value that the index of the frame of the ring shown on the next step.")]
+        public byte FrameRingHead { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the LedStatus register.
+        /// Creates a message payload for the FrameRingHead register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public byte GetPayload()
         {
-            return LedStatus;
+            return FrameRingHead;
         }
 
         /// <summary>
-        /// Creates a message for register LedStatus.
+        /// Creates a message that the index of the frame of the ring shown on the next step.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the LedStatus register.</returns>
+        /// <returns>A new message for the FrameRingHead register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.LedStatus.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.FrameRingHead.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// for register LedStatus.
+    /// that the index of the frame of the ring shown on the next step.
     /// </summary>
-    [DisplayName("TimestampedLedStatusPayload")]
-    [Description("Creates a timestamped message payload for register LedStatus.")]
-    public partial class CreateTimestampedLedStatusPayload : CreateLedStatusPayload
+    [DisplayName("TimestampedFrameRingHeadPayload")]
+    [Description("Creates a timestamped message payload that the index of the frame of the ring shown on the next step.")]
+    public partial class CreateTimestampedFrameRingHeadPayload : CreateFrameRingHeadPayload
     {
         /// <summary>
-        /// Creates a timestamped message for register LedStatus.
+        /// Creates a timestamped message that the index of the frame of the ring shown on the next step.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the LedStatus register.</returns>
+        /// <returns>A new timestamped message for the FrameRingHead register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.LedStatus.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.FrameRingHead.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the number of LEDs connected on each bus of the device.
+    /// that the index of the ring where the next frame is appended.
     /// </summary>
-    [DisplayName("LedCountPayload")]
-    [Description("Creates a message payload that the number of LEDs connected on each bus of the device.")]
-    public partial class CreateLedCountPayload
+    [DisplayName("FrameRingTailPayload")]
+    [Description("Creates a message payload that the index of the ring where the next frame is appended.")]
+    public partial class CreateFrameRingTailPayload
     {
         /// <summary>
-        /// Gets or sets the value that the number of LEDs connected on each bus of the device.
+        /// Gets or sets the value that the index of the ring where the next frame is appended.
         /// </summary>
-        [Range(min: long.MinValue, max: 32)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that the number of LEDs connected on each bus of the device.")]
-        public byte LedCount { get; set; }
+        [Description("The value that the index of the ring where the next frame is appended.")]
+        public byte FrameRingTail { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the LedCount register.
+        /// Creates a message payload for the FrameRingTail register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public byte GetPayload()
         {
-            return LedCount;
+            return FrameRingTail;
         }
 
         /// <summary>
-        /// Creates a message that the number of LEDs connected on each bus of the device.
+        /// Creates a message that the index of the ring where the next frame is appended.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the LedCount register.</returns>
+        /// <returns>A new message for the FrameRingTail register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.LedCount.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.FrameRingTail.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the number of LEDs connected on each bus of the device.
+    /// that the index of the ring where the next frame is appended.
     /// </summary>
-    [DisplayName("TimestampedLedCountPayload")]
-    [Description("Creates a timestamped message payload that the number of LEDs connected on each bus of the device.")]
-    public partial class CreateTimestampedLedCountPayload : CreateLedCountPayload
+    [DisplayName("TimestampedFrameRingTailPayload")]
+    [Description("Creates a timestamped message payload that the index of the ring where the next frame is appended.")]
+    public partial class CreateTimestampedFrameRingTailPayload : CreateFrameRingTailPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the number of LEDs connected on each bus of the device.
+        /// Creates a timestamped message that the index of the ring where the next frame is appended.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the LedCount register.</returns>
+        /// <returns>A new timestamped message for the FrameRingTail register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.LedCount.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.FrameRingTail.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// that the time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.
     /// </summary>
-    [DisplayName("RgbStatePayload")]
-    [Description("Creates a message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
-    public partial class CreateRgbStatePayload
+    [DisplayName("PulseOnTimePayload")]
+    [Description("Creates a message payload that the time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.")]
+    public partial class CreatePulseOnTimePayload
     {
         /// <summary>
-        /// Gets or sets the value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// Gets or sets the value that the time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.
         /// </summary>
-        [Description("The value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
-        public byte[] RgbState { get; set; }
+        [Range(min: 100, max: 1000000000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.")]
+        public uint PulseOnTime { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the RgbState register.
+        /// Creates a message payload for the PulseOnTime register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte[] GetPayload()
+        public uint GetPayload()
         {
-            return RgbState;
+            return PulseOnTime;
         }
 
         /// <summary>
-        /// Creates a message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// Creates a message that the time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the RgbState register.</returns>
+        /// <returns>A new message for the PulseOnTime register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.RgbState.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.PulseOnTime.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// that the time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.
     /// </summary>
-    [DisplayName("TimestampedRgbStatePayload")]
-    [Description("Creates a timestamped message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
-    public partial class CreateTimestampedRgbStatePayload : CreateRgbStatePayload
+    [DisplayName("TimestampedPulseOnTimePayload")]
+    [Description("Creates a timestamped message payload that the time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.")]
+    public partial class CreateTimestampedPulseOnTimePayload : CreatePulseOnTimePayload
     {
         /// <summary>
-        /// Creates a timestamped message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// Creates a timestamped message that the time in microseconds the LEDs are on on each pulse started by DigitalOutputPulseCount.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the RgbState register.</returns>
+        /// <returns>A new timestamped message for the PulseOnTime register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.RgbState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.PulseOnTime.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// that the time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.
     /// </summary>
-    [DisplayName("RgbBus0StatePayload")]
-    [Description("Creates a message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
-    public partial class CreateRgbBus0StatePayload
+    [DisplayName("PulseOffTimePayload")]
+    [Description("Creates a message payload that the time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.")]
+    public partial class CreatePulseOffTimePayload
     {
         /// <summary>
-        /// Gets or sets the value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// Gets or sets the value that the time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.
         /// </summary>
-        [Description("The value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
-        public byte[] RgbBus0State { get; set; }
+        [Range(min: 100, max: 1000000000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.")]
+        public uint PulseOffTime { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the RgbBus0State register.
+        /// Creates a message payload for the PulseOffTime register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte[] GetPayload()
+        public uint GetPayload()
         {
-            return RgbBus0State;
+            return PulseOffTime;
         }
 
         /// <summary>
-        /// Creates a message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// Creates a message that the time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the RgbBus0State register.</returns>
+        /// <returns>A new message for the PulseOffTime register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.RgbBus0State.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.PulseOffTime.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// that the time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.
     /// </summary>
-    [DisplayName("TimestampedRgbBus0StatePayload")]
-    [Description("Creates a timestamped message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
-    public partial class CreateTimestampedRgbBus0StatePayload : CreateRgbBus0StatePayload
+    [DisplayName("TimestampedPulseOffTimePayload")]
+    [Description("Creates a timestamped message payload that the time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.")]
+    public partial class CreateTimestampedPulseOffTimePayload : CreatePulseOffTimePayload
     {
         /// <summary>
-        /// Creates a timestamped message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// Creates a timestamped message that the time in microseconds the LEDs are off after each pulse started by DigitalOutputPulseCount.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the RgbBus0State register.</returns>
+        /// <returns>A new timestamped message for the PulseOffTime register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.RgbBus0State.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.PulseOffTime.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// that the microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.
     /// </summary>
-    [DisplayName("RgbBus1StatePayload")]
-    [Description("Creates a message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
-    public partial class CreateRgbBus1StatePayload
+    [DisplayName("DisplayTimePayload")]
+    [Description("Creates a message payload that the microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.")]
+    public partial class CreateDisplayTimePayload
     {
         /// <summary>
-        /// Gets or sets the value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// Gets or sets the value that the microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.
         /// </summary>
-        [Description("The value that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
-        public byte[] RgbBus1State { get; set; }
+        [Description("The value that the microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.")]
+        public ushort DisplayTime { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the RgbBus1State register.
+        /// Creates a message payload for the DisplayTime register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte[] GetPayload()
+        public ushort GetPayload()
         {
-            return RgbBus1State;
+            return DisplayTime;
         }
 
         /// <summary>
-        /// Creates a message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// Creates a message that the microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the RgbBus1State register.</returns>
+        /// <returns>A new message for the DisplayTime register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.RgbBus1State.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.DisplayTime.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+    /// that the microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.
     /// </summary>
-    [DisplayName("TimestampedRgbBus1StatePayload")]
-    [Description("Creates a timestamped message payload that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].")]
-    public partial class CreateTimestampedRgbBus1StatePayload : CreateRgbBus1StatePayload
+    [DisplayName("TimestampedDisplayTimePayload")]
+    [Description("Creates a timestamped message payload that the microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.")]
+    public partial class CreateTimestampedDisplayTimePayload : CreateDisplayTimePayload
     {
         /// <summary>
-        /// Creates a timestamped message that the RGB color of each LED. [R0 G0 B0 R1 G1 B1 ...].
+        /// Creates a timestamped message that the microseconds from the update to the LEDs showing the frame, including the crossfade, up to 65535. The event is timestamped with the time the LEDs show the frame.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the RgbBus1State register.</returns>
+        /// <returns>A new timestamped message for the DisplayTime register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.RgbBus1State.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.DisplayTime.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the RGB color of the LEDs when they are off.
+    /// that the min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.
     /// </summary>
-    [DisplayName("RgbOffStatePayload")]
-    [Description("Creates a message payload that the RGB color of the LEDs when they are off.")]
-    public partial class CreateRgbOffStatePayload
+    [DisplayName("LatencyStatsPayload")]
+    [Description("Creates a message payload that the min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.")]
+    public partial class CreateLatencyStatsPayload
     {
         /// <summary>
-        /// Gets or sets the value that the RGB color of the LEDs when they are off.
+        /// Gets or sets the value that the min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.
         /// </summary>
-        [Description("The value that the RGB color of the LEDs when they are off.")]
-        public byte[] RgbOffState { get; set; }
+        [Description("The value that the min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.")]
+        public uint[] LatencyStats { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the RgbOffState register.
+        /// Creates a message payload for the LatencyStats register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte[] GetPayload()
+        public uint[] GetPayload()
         {
-            return RgbOffState;
+            return LatencyStats;
         }
 
         /// <summary>
-        /// Creates a message that the RGB color of the LEDs when they are off.
+        /// Creates a message that the min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the RgbOffState register.</returns>
+        /// <returns>A new message for the LatencyStats register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.RgbOffState.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.LatencyStats.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the RGB color of the LEDs when they are off.
+    /// that the min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.
     /// </summary>
-    [DisplayName("TimestampedRgbOffStatePayload")]
-    [Description("Creates a timestamped message payload that the RGB color of the LEDs when they are off.")]
-    public partial class CreateTimestampedRgbOffStatePayload : CreateRgbOffStatePayload
+    [DisplayName("TimestampedLatencyStatsPayload")]
+    [Description("Creates a timestamped message payload that the min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.")]
+    public partial class CreateTimestampedLatencyStatsPayload : CreateLatencyStatsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the RGB color of the LEDs when they are off.
+        /// Creates a timestamped message that the min, max and rolling mean microseconds of each stage of the frames [LoadMin LoadMax LoadMean WaitMin WaitMax WaitMean ShowMin ShowMax ShowMean TotalMin TotalMax TotalMean]. Load goes from the frame sent to the slaves to their load done, Wait until the update and Show until the slaves updated the LEDs. Any write clears the statistics and the histogram.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the RgbOffState register.</returns>
+        /// <returns>A new timestamped message for the LatencyStats register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.RgbOffState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.LatencyStats.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// for register DI0Mode.
+    /// that the number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.
     /// </summary>
-    [DisplayName("DI0ModePayload")]
-    [Description("Creates a message payload for register DI0Mode.")]
-    public partial class CreateDI0ModePayload
+    [DisplayName("LatencyHistogramPayload")]
+    [Description("Creates a message payload that the number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.")]
+    public partial class CreateLatencyHistogramPayload
     {
         /// <summary>
-        /// Gets or sets the value for register DI0Mode.
+        /// Gets or sets the value that the number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.
         /// </summary>
-        [Description("The value for register DI0Mode.")]
-        public DI0ModeConfig DI0Mode { get; set; }
+        [Description("The value that the number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.")]
+        public ushort[] LatencyHistogram { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LatencyHistogram register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return LatencyHistogram;
+        }
+
+        /// <summary>
+        /// Creates a message that the number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LatencyHistogram register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RgbArray.LatencyHistogram.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.
+    /// </summary>
+    [DisplayName("TimestampedLatencyHistogramPayload")]
+    [Description("Creates a timestamped message payload that the number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.")]
+    public partial class CreateTimestampedLatencyHistogramPayload : CreateLatencyHistogramPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the number of frames by total latency, in buckets of 1 ms. The last bucket has the frames of 15 ms or more. Any write clears the statistics and the histogram.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LatencyHistogram register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RgbArray.LatencyHistogram.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.
+    /// </summary>
+    [DisplayName("FrameCountersPayload")]
+    [Description("Creates a message payload that the number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.")]
+    public partial class CreateFrameCountersPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.
+        /// </summary>
+        [Description("The value that the number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.")]
+        public uint[] FrameCounters { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DI0Mode register.
+        /// Creates a message payload for the FrameCounters register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DI0ModeConfig GetPayload()
+        public uint[] GetPayload()
         {
-            return DI0Mode;
+            return FrameCounters;
         }
 
         /// <summary>
-        /// Creates a message for register DI0Mode.
+        /// Creates a message that the number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DI0Mode register.</returns>
+        /// <returns>A new message for the FrameCounters register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.DI0Mode.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.FrameCounters.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// for register DI0Mode.
+    /// that the number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.
     /// </summary>
-    [DisplayName("TimestampedDI0ModePayload")]
-    [Description("Creates a timestamped message payload for register DI0Mode.")]
-    public partial class CreateTimestampedDI0ModePayload : CreateDI0ModePayload
+    [DisplayName("TimestampedFrameCountersPayload")]
+    [Description("Creates a timestamped message payload that the number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.")]
+    public partial class CreateTimestampedFrameCountersPayload : CreateFrameCountersPayload
     {
         /// <summary>
-        /// Creates a timestamped message for register DI0Mode.
+        /// Creates a timestamped message that the number of frames [Received Displayed Dropped]. A frame is dropped when it's replaced before its update, cleared from a queue or a bus has no room for it. Any write clears the counters.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DI0Mode register.</returns>
+        /// <returns>A new timestamped message for the FrameCounters register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.DI0Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.FrameCounters.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// for register DO0Mode.
+    /// that the number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.
     /// </summary>
-    [DisplayName("DO0ModePayload")]
-    [Description("Creates a message payload for register DO0Mode.")]
-    public partial class CreateDO0ModePayload
+    [DisplayName("LoadTimeoutsPayload")]
+    [Description("Creates a message payload that the number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.")]
+    public partial class CreateLoadTimeoutsPayload
     {
         /// <summary>
-        /// Gets or sets the value for register DO0Mode.
+        /// Gets or sets the value that the number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.
         /// </summary>
-        [Description("The value for register DO0Mode.")]
-        public DOModeConfig DO0Mode { get; set; }
+        [Description("The value that the number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.")]
+        public uint LoadTimeouts { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0Mode register.
+        /// Creates a message payload for the LoadTimeouts register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DOModeConfig GetPayload()
+        public uint GetPayload()
         {
-            return DO0Mode;
+            return LoadTimeouts;
         }
 
         /// <summary>
-        /// Creates a message for register DO0Mode.
+        /// Creates a message that the number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0Mode register.</returns>
+        /// <returns>A new message for the LoadTimeouts register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.DO0Mode.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.LoadTimeouts.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// for register DO0Mode.
+    /// that the number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.
     /// </summary>
-    [DisplayName("TimestampedDO0ModePayload")]
-    [Description("Creates a timestamped message payload for register DO0Mode.")]
-    public partial class CreateTimestampedDO0ModePayload : CreateDO0ModePayload
+    [DisplayName("TimestampedLoadTimeoutsPayload")]
+    [Description("Creates a timestamped message payload that the number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.")]
+    public partial class CreateTimestampedLoadTimeoutsPayload : CreateLoadTimeoutsPayload
     {
         /// <summary>
-        /// Creates a timestamped message for register DO0Mode.
+        /// Creates a timestamped message that the number of updates done after waiting 50 ms for the load of the other bus. The late bus shows its last loaded frame.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0Mode register.</returns>
+        /// <returns>A new timestamped message for the LoadTimeouts register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.DO0Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.LoadTimeouts.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// for register DO1Mode.
+    /// that the microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.
     /// </summary>
-    [DisplayName("DO1ModePayload")]
-    [Description("Creates a message payload for register DO1Mode.")]
-    public partial class CreateDO1ModePayload
+    [DisplayName("LatchSkewPayload")]
+    [Description("Creates a message payload that the microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.")]
+    public partial class CreateLatchSkewPayload
     {
         /// <summary>
-        /// Gets or sets the value for register DO1Mode.
+        /// Gets or sets the value that the microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.
         /// </summary>
-        [Description("The value for register DO1Mode.")]
-        public DOModeConfig DO1Mode { get; set; }
+        [Description("The value that the microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.")]
+        public short[] LatchSkew { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO1Mode register.
+        /// Creates a message payload for the LatchSkew register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DOModeConfig GetPayload()
+        public short[] GetPayload()
         {
-            return DO1Mode;
+            return LatchSkew;
         }
 
         /// <summary>
-        /// Creates a message for register DO1Mode.
+        /// Creates a message that the microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1Mode register.</returns>
+        /// <returns>A new message for the LatchSkew register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.DO1Mode.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.LatchSkew.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// for register DO1Mode.
+    /// that the microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.
     /// </summary>
-    [DisplayName("TimestampedDO1ModePayload")]
-    [Description("Creates a timestamped message payload for register DO1Mode.")]
-    public partial class CreateTimestampedDO1ModePayload : CreateDO1ModePayload
+    [DisplayName("TimestampedLatchSkewPayload")]
+    [Description("Creates a timestamped message payload that the microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.")]
+    public partial class CreateTimestampedLatchSkewPayload : CreateLatchSkewPayload
     {
         /// <summary>
-        /// Creates a timestamped message for register DO1Mode.
+        /// Creates a timestamped message that the microseconds from the update of the bus 0 to the update of the bus 1, measured on the LEDS_UPDATED of both slaves [Last Min Max]. Any write clears it.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1Mode register.</returns>
+        /// <returns>A new timestamped message for the LatchSkew register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.DO1Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.LatchSkew.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+    /// that the fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.
     /// </summary>
-    [DisplayName("LatchOnNextUpdatePayload")]
-    [Description("Creates a message payload that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.")]
-    public partial class CreateLatchOnNextUpdatePayload
+    [DisplayName("LinkSpeedPayload")]
+    [Description("Creates a message payload that the fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.")]
+    public partial class CreateLinkSpeedPayload
     {
         /// <summary>
-        /// Gets or sets the value that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+        /// Gets or sets the value that the fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.
         /// </summary>
-        [Description("The value that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.")]
-        public EnableFlag LatchOnNextUpdate { get; set; }
+        [Description("The value that the fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.")]
+        public LinkSpeedConfig LinkSpeed { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the LatchOnNextUpdate register.
+        /// Creates a message payload for the LinkSpeed register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
+        public LinkSpeedConfig GetPayload()
         {
-            return LatchOnNextUpdate;
+            return LinkSpeed;
         }
 
         /// <summary>
-        /// Creates a message that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+        /// Creates a message that the fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the LatchOnNextUpdate register.</returns>
+        /// <returns>A new message for the LinkSpeed register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.LatchOnNextUpdate.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.LinkSpeed.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+    /// that the fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.
     /// </summary>
-    [DisplayName("TimestampedLatchOnNextUpdatePayload")]
-    [Description("Creates a timestamped message payload that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.")]
-    public partial class CreateTimestampedLatchOnNextUpdatePayload : CreateLatchOnNextUpdatePayload
+    [DisplayName("TimestampedLinkSpeedPayload")]
+    [Description("Creates a timestamped message payload that the fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.")]
+    public partial class CreateTimestampedLinkSpeedPayload : CreateLinkSpeedPayload
     {
         /// <summary>
-        /// Creates a timestamped message that updates the settings of the RGBs, but will queue the instruction until a valid LedStatus command.
+        /// Creates a timestamped message that the fastest speed negotiated with the slaves. A write negotiates it again. The slaves that don't reply at the speed fall back to the slower ones.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the LatchOnNextUpdate register.</returns>
+        /// <returns>A new timestamped message for the LinkSpeed register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.LatchOnNextUpdate.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.LinkSpeed.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that reflects the state of DI digital lines of each Port.
+    /// that the speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.
     /// </summary>
-    [DisplayName("DigitalInputStatePayload")]
-    [Description("Creates a message payload that reflects the state of DI digital lines of each Port.")]
-    public partial class CreateDigitalInputStatePayload
+    [DisplayName("LinkStatusPayload")]
+    [Description("Creates a message payload that the speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.")]
+    public partial class CreateLinkStatusPayload
     {
         /// <summary>
-        /// Gets or sets the value that reflects the state of DI digital lines of each Port.
+        /// Gets or sets the value that the speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.
         /// </summary>
-        [Description("The value that reflects the state of DI digital lines of each Port.")]
-        public DigitalInputs DigitalInputState { get; set; }
+        [Description("The value that the speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.")]
+        public byte[] LinkStatus { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalInputState register.
+        /// Creates a message payload for the LinkStatus register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalInputs GetPayload()
+        public byte[] GetPayload()
         {
-            return DigitalInputState;
+            return LinkStatus;
         }
 
         /// <summary>
-        /// Creates a message that reflects the state of DI digital lines of each Port.
+        /// Creates a message that the speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalInputState register.</returns>
+        /// <returns>A new message for the LinkStatus register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.DigitalInputState.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.LinkStatus.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that reflects the state of DI digital lines of each Port.
+    /// that the speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.
     /// </summary>
-    [DisplayName("TimestampedDigitalInputStatePayload")]
-    [Description("Creates a timestamped message payload that reflects the state of DI digital lines of each Port.")]
-    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    [DisplayName("TimestampedLinkStatusPayload")]
+    [Description("Creates a timestamped message payload that the speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.")]
+    public partial class CreateTimestampedLinkStatusPayload : CreateLinkStatusPayload
     {
         /// <summary>
-        /// Creates a timestamped message that reflects the state of DI digital lines of each Port.
+        /// Creates a timestamped message that the speed and framing of the link to the slave of each bus [Bus0 Bus1]. The bits 0 and 1 have the LinkSpeed, the bit 2 is set with the v2 framing and the bit 3 while negotiating.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        /// <returns>A new timestamped message for the LinkStatus register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.LinkStatus.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that set the specified digital output lines.
+    /// that the colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.
     /// </summary>
-    [DisplayName("OutputSetPayload")]
-    [Description("Creates a message payload that set the specified digital output lines.")]
-    public partial class CreateOutputSetPayload
+    [DisplayName("PalettePayload")]
+    [Description("Creates a message payload that the colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.")]
+    public partial class CreatePalettePayload
     {
         /// <summary>
-        /// Gets or sets the value that set the specified digital output lines.
+        /// Gets or sets the value that the colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.
         /// </summary>
-        [Description("The value that set the specified digital output lines.")]
-        public DigitalOutputs OutputSet { get; set; }
+        [Description("The value that the colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.")]
+        public byte[] Palette { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputSet register.
+        /// Creates a message payload for the Palette register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public byte[] GetPayload()
         {
-            return OutputSet;
+            return Palette;
         }
 
         /// <summary>
-        /// Creates a message that set the specified digital output lines.
+        /// Creates a message that the colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputSet register.</returns>
+        /// <returns>A new message for the Palette register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.OutputSet.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.Palette.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that set the specified digital output lines.
+    /// that the colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.
     /// </summary>
-    [DisplayName("TimestampedOutputSetPayload")]
-    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
-    public partial class CreateTimestampedOutputSetPayload : CreateOutputSetPayload
+    [DisplayName("TimestampedPalettePayload")]
+    [Description("Creates a timestamped message payload that the colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.")]
+    public partial class CreateTimestampedPalettePayload : CreatePalettePayload
     {
         /// <summary>
-        /// Creates a timestamped message that set the specified digital output lines.
+        /// Creates a timestamped message that the colors of the 64 entries of the palette used by the indexed frames [R0 G0 B0 R1 G1 B1 ...]. It's sent to both buses.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputSet register.</returns>
+        /// <returns>A new timestamped message for the Palette register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.OutputSet.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.Palette.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that clear the specified digital output lines.
+    /// that shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.
     /// </summary>
-    [DisplayName("OutputClearPayload")]
-    [Description("Creates a message payload that clear the specified digital output lines.")]
-    public partial class CreateOutputClearPayload
+    [DisplayName("PaletteFramePayload")]
+    [Description("Creates a message payload that shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.")]
+    public partial class CreatePaletteFramePayload
     {
         /// <summary>
-        /// Gets or sets the value that clear the specified digital output lines.
+        /// Gets or sets the value that shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.
         /// </summary>
-        [Description("The value that clear the specified digital output lines.")]
-        public DigitalOutputs OutputClear { get; set; }
+        [Description("The value that shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.")]
+        public byte[] PaletteFrame { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputClear register.
+        /// Creates a message payload for the PaletteFrame register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public byte[] GetPayload()
         {
-            return OutputClear;
+            return PaletteFrame;
         }
 
         /// <summary>
-        /// Creates a message that clear the specified digital output lines.
+        /// Creates a message that shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputClear register.</returns>
+        /// <returns>A new message for the PaletteFrame register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.OutputClear.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.PaletteFrame.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that clear the specified digital output lines.
+    /// that shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.
     /// </summary>
-    [DisplayName("TimestampedOutputClearPayload")]
-    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
-    public partial class CreateTimestampedOutputClearPayload : CreateOutputClearPayload
+    [DisplayName("TimestampedPaletteFramePayload")]
+    [Description("Creates a timestamped message payload that shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.")]
+    public partial class CreateTimestampedPaletteFramePayload : CreatePaletteFramePayload
     {
         /// <summary>
-        /// Creates a timestamped message that clear the specified digital output lines.
+        /// Creates a timestamped message that shows a frame with the palette index of each LED, LedCount LEDs of bus 0 at 0 and of bus 1 at 32. The frame takes 1 byte per LED on the link, or half a byte when all the indexes are below 16.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputClear register.</returns>
+        /// <returns>A new timestamped message for the PaletteFrame register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.OutputClear.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.PaletteFrame.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that toggle the specified digital output lines.
+    /// that appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.
     /// </summary>
-    [DisplayName("OutputTogglePayload")]
-    [Description("Creates a message payload that toggle the specified digital output lines.")]
-    public partial class CreateOutputTogglePayload
+    [DisplayName("SequencePaletteFramePayload")]
+    [Description("Creates a message payload that appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.")]
+    public partial class CreateSequencePaletteFramePayload
     {
         /// <summary>
-        /// Gets or sets the value that toggle the specified digital output lines.
+        /// Gets or sets the value that appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.
         /// </summary>
-        [Description("The value that toggle the specified digital output lines.")]
-        public DigitalOutputs OutputToggle { get; set; }
+        [Description("The value that appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.")]
+        public byte[] SequencePaletteFrame { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputToggle register.
+        /// Creates a message payload for the SequencePaletteFrame register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public byte[] GetPayload()
         {
-            return OutputToggle;
+            return SequencePaletteFrame;
         }
 
         /// <summary>
-        /// Creates a message that toggle the specified digital output lines.
+        /// Creates a message that appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputToggle register.</returns>
+        /// <returns>A new message for the SequencePaletteFrame register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.OutputToggle.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.SequencePaletteFrame.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that toggle the specified digital output lines.
+    /// that appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.
     /// </summary>
-    [DisplayName("TimestampedOutputTogglePayload")]
-    [Description("Creates a timestamped message payload that toggle the specified digital output lines.")]
-    public partial class CreateTimestampedOutputTogglePayload : CreateOutputTogglePayload
+    [DisplayName("TimestampedSequencePaletteFramePayload")]
+    [Description("Creates a timestamped message payload that appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.")]
+    public partial class CreateTimestampedSequencePaletteFramePayload : CreateSequencePaletteFramePayload
     {
         /// <summary>
-        /// Creates a timestamped message that toggle the specified digital output lines.
+        /// Creates a timestamped message that appends an indexed frame to the sequence stored on the buses, in the format of PaletteFrame. It takes 1/3 or 1/6 of the space of a SequenceFrame and gets the colors of the palette when shown.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputToggle register.</returns>
+        /// <returns>A new timestamped message for the SequencePaletteFrame register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.OutputToggle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.SequencePaletteFrame.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that write the state of all digital output lines.
+    /// that the CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.
     /// </summary>
-    [DisplayName("OutputStatePayload")]
-    [Description("Creates a message payload that write the state of all digital output lines.")]
-    public partial class CreateOutputStatePayload
+    [DisplayName("FrameCrcPayload")]
+    [Description("Creates a message payload that the CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.")]
+    public partial class CreateFrameCrcPayload
     {
         /// <summary>
-        /// Gets or sets the value that write the state of all digital output lines.
+        /// Gets or sets the value that the CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.
         /// </summary>
-        [Description("The value that write the state of all digital output lines.")]
-        public DigitalOutputs OutputState { get; set; }
+        [Description("The value that the CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.")]
+        public ushort[] FrameCrc { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputState register.
+        /// Creates a message payload for the FrameCrc register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public ushort[] GetPayload()
         {
-            return OutputState;
+            return FrameCrc;
         }
 
         /// <summary>
-        /// Creates a message that write the state of all digital output lines.
+        /// Creates a message that the CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputState register.</returns>
+        /// <returns>A new message for the FrameCrc register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.OutputState.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.FrameCrc.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that write the state of all digital output lines.
+    /// that the CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.
     /// </summary>
-    [DisplayName("TimestampedOutputStatePayload")]
-    [Description("Creates a timestamped message payload that write the state of all digital output lines.")]
-    public partial class CreateTimestampedOutputStatePayload : CreateOutputStatePayload
+    [DisplayName("TimestampedFrameCrcPayload")]
+    [Description("Creates a timestamped message payload that the CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.")]
+    public partial class CreateTimestampedFrameCrcPayload : CreateFrameCrcPayload
     {
         /// <summary>
-        /// Creates a timestamped message that write the state of all digital output lines.
+        /// Creates a timestamped message that the CRC-16 (0x1021 reflected, initial value 0xFFFF) of the bytes each slave sent to the LEDs on its last update [Bus0 Bus1]. The bytes are [G][R][B] of each LED after the brightness and gamma, or the bit planes with the parallel strips.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputState register.</returns>
+        /// <returns>A new timestamped message for the FrameCrc register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.OutputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.FrameCrc.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the pulse period in milliseconds for digital outputs.
+    /// that the errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.
     /// </summary>
-    [DisplayName("DigitalOutputPulsePeriodPayload")]
-    [Description("Creates a message payload that the pulse period in milliseconds for digital outputs.")]
-    public partial class CreateDigitalOutputPulsePeriodPayload
+    [DisplayName("LinkErrorsPayload")]
+    [Description("Creates a message payload that the errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.")]
+    public partial class CreateLinkErrorsPayload
     {
         /// <summary>
-        /// Gets or sets the value that the pulse period in milliseconds for digital outputs.
+        /// Gets or sets the value that the errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.
         /// </summary>
-        [Description("The value that the pulse period in milliseconds for digital outputs.")]
-        public ushort DigitalOutputPulsePeriod { get; set; }
+        [Description("The value that the errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.")]
+        public uint[] LinkErrors { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputPulsePeriod register.
+        /// Creates a message payload for the LinkErrors register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public uint[] GetPayload()
         {
-            return DigitalOutputPulsePeriod;
+            return LinkErrors;
         }
 
         /// <summary>
-        /// Creates a message that the pulse period in milliseconds for digital outputs.
+        /// Creates a message that the errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputPulsePeriod register.</returns>
+        /// <returns>A new message for the LinkErrors register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.DigitalOutputPulsePeriod.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.LinkErrors.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the pulse period in milliseconds for digital outputs.
+    /// that the errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputPulsePeriodPayload")]
-    [Description("Creates a timestamped message payload that the pulse period in milliseconds for digital outputs.")]
-    public partial class CreateTimestampedDigitalOutputPulsePeriodPayload : CreateDigitalOutputPulsePeriodPayload
+    [DisplayName("TimestampedLinkErrorsPayload")]
+    [Description("Creates a timestamped message payload that the errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.")]
+    public partial class CreateTimestampedLinkErrorsPayload : CreateLinkErrorsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the pulse period in milliseconds for digital outputs.
+        /// Creates a timestamped message that the errors seen on the links [Bus0 Bus1], 6 counters for each bus - slave UART errors, slave timeouts, slave noise bytes, slave CRC errors, master UART errors and master noise bytes. Any write clears the counters.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputPulsePeriod register.</returns>
+        /// <returns>A new timestamped message for the LinkErrors register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.DigitalOutputPulsePeriod.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.LinkErrors.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that triggers the specified number of pulses on the digital output lines.
+    /// that the number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.
     /// </summary>
-    [DisplayName("DigitalOutputPulseCountPayload")]
-    [Description("Creates a message payload that triggers the specified number of pulses on the digital output lines.")]
-    public partial class CreateDigitalOutputPulseCountPayload
+    [DisplayName("LinkResyncsPayload")]
+    [Description("Creates a message payload that the number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.")]
+    public partial class CreateLinkResyncsPayload
     {
         /// <summary>
-        /// Gets or sets the value that triggers the specified number of pulses on the digital output lines.
+        /// Gets or sets the value that the number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.
         /// </summary>
-        [Description("The value that triggers the specified number of pulses on the digital output lines.")]
-        public byte DigitalOutputPulseCount { get; set; }
+        [Description("The value that the number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.")]
+        public uint[] LinkResyncs { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputPulseCount register.
+        /// Creates a message payload for the LinkResyncs register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public uint[] GetPayload()
         {
-            return DigitalOutputPulseCount;
+            return LinkResyncs;
         }
 
         /// <summary>
-        /// Creates a message that triggers the specified number of pulses on the digital output lines.
+        /// Creates a message that the number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputPulseCount register.</returns>
+        /// <returns>A new message for the LinkResyncs register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.DigitalOutputPulseCount.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.LinkResyncs.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that triggers the specified number of pulses on the digital output lines.
+    /// that the number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputPulseCountPayload")]
-    [Description("Creates a timestamped message payload that triggers the specified number of pulses on the digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputPulseCountPayload : CreateDigitalOutputPulseCountPayload
+    [DisplayName("TimestampedLinkResyncsPayload")]
+    [Description("Creates a timestamped message payload that the number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.")]
+    public partial class CreateTimestampedLinkResyncsPayload : CreateLinkResyncsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that triggers the specified number of pulses on the digital output lines.
+        /// Creates a timestamped message that the number of times each link went back to 1 Mb/s and was negotiated again after repeated errors [Bus0 Bus1]. Any write clears the counters.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputPulseCount register.</returns>
+        /// <returns>A new timestamped message for the LinkResyncs register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.DigitalOutputPulseCount.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.LinkResyncs.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that specifies the active events in the device.
+    /// that the latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.
     /// </summary>
-    [DisplayName("EventEnablePayload")]
-    [Description("Creates a message payload that specifies the active events in the device.")]
-    public partial class CreateEventEnablePayload
+    [DisplayName("UpdateLatencyPayload")]
+    [Description("Creates a message payload that the latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.")]
+    public partial class CreateUpdateLatencyPayload
     {
         /// <summary>
-        /// Gets or sets the value that specifies the active events in the device.
+        /// Gets or sets the value that the latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.
         /// </summary>
-        [Description("The value that specifies the active events in the device.")]
-        public RgbArrayEvents EventEnable { get; set; }
+        [Description("The value that the latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.")]
+        public ushort[] UpdateLatency { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EventEnable register.
+        /// Creates a message payload for the UpdateLatency register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public RgbArrayEvents GetPayload()
+        public ushort[] GetPayload()
         {
-            return EventEnable;
+            return UpdateLatency;
         }
 
         /// <summary>
-        /// Creates a message that specifies the active events in the device.
+        /// Creates a message that the latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EventEnable register.</returns>
+        /// <returns>A new message for the UpdateLatency register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RgbArray.EventEnable.FromPayload(messageType, GetPayload());
+            return Harp.RgbArray.UpdateLatency.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that specifies the active events in the device.
+    /// that the latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.
     /// </summary>
-    [DisplayName("TimestampedEventEnablePayload")]
-    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
-    public partial class CreateTimestampedEventEnablePayload : CreateEventEnablePayload
+    [DisplayName("TimestampedUpdateLatencyPayload")]
+    [Description("Creates a timestamped message payload that the latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.")]
+    public partial class CreateTimestampedUpdateLatencyPayload : CreateUpdateLatencyPayload
     {
         /// <summary>
-        /// Creates a timestamped message that specifies the active events in the device.
+        /// Creates a timestamped message that the latency from the rising edge of DI0 to the update pulse of each bus in UpdateOnRisingEdgeEvent mode, measured on the pins with a resolution of 31.25 ns [LastBus0 MinBus0 MaxBus0 LastBus1 MinBus1 MaxBus1], in nanoseconds. Any write clears the measures.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EventEnable register.</returns>
+        /// <returns>A new timestamped message for the UpdateLatency register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RgbArray.EventEnable.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RgbArray.UpdateLatency.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
@@ -3151,6 +9118,19 @@ namespace Harp.RgbArray
         DO4 = 0x16
     }
 
+    /// <summary>
+    /// Commands of the stored sequence.
+    /// </summary>
+    [Flags]
+    public enum SequenceCommands : byte
+    {
+        None = 0x0,
+        Clear = 0x1,
+        Rewind = 0x2,
+        Play = 0x4,
+        Stop = 0x8
+    }
+
     /// <summary>
     /// Specifies the operation mode of the DI0 pin.
     /// </summary>
@@ -3169,7 +9149,17 @@ namespace Harp.RgbArray
         /// <summary>
         /// Able to update RGBs when the pin is HIGH. Turn LEDs off when rising edge is detected.
         /// </summary>
-        UpdateOnHigh = 2
+        UpdateOnHigh = 2,
+
+        /// <summary>
+        /// Show the next frame of FrameRing when the DI0 pin transitions from low to high.
+        /// </summary>
+        StepFrames = 3,
+
+        /// <summary>
+        /// Update the LED colors when the DI0 pin transitions from low to high, routed by the event system and the DMA without the CPU, ~250 ns after the edge as measured on UpdateLatency. Only the rising edges of DI0 are reported.
+        /// </summary>
+        UpdateOnRisingEdgeEvent = 4
     }
 
     /// <summary>
@@ -3203,12 +9193,35 @@ namespace Harp.RgbArray
         ToggleOnLoad = 4
     }
 
+    /// <summary>
+    /// Speed of the links to the slaves.
+    /// </summary>
+    public enum LinkSpeedConfig : byte
+    {
+        /// <summary>
+        /// 1 Mb/s.
+        /// </summary>
+        Speed1Mbps = 0,
+
+        /// <summary>
+        /// 2 Mb/s.
+        /// </summary>
+        Speed2Mbps = 1,
+
+        /// <summary>
+        /// 4 Mb/s.
+        /// </summary>
+        Speed4Mbps = 2
+    }
+
     /// <summary>
     /// Available events to be enable in the board.
     /// </summary>
     public enum RgbArrayEvents : byte
     {
         LedStatus = 1,
-        DigitalInputs = 2
+        DigitalInputs = 2,
+        DisplayTime = 4,
+        FrameCrc = 8
     }
 }